@@ -0,0 +1,331 @@
+/**
+ * @file        main.cc
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Benchmarks comparing property access against raw members and hand-written accessors.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "property.h"
+#include "property_atomic.h"
+#include "property_cache_aligned.h"
+
+namespace
+{
+
+/**
+ * The large trivially copyable value.
+ */
+struct pod_4k
+{
+    std::array<std::byte, 4096> bytes;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// The sample values.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+T make_value();
+
+template <>
+int make_value<int>()
+{
+    return 42;
+}
+
+template <>
+double make_value<double>()
+{
+    return 42.5;
+}
+
+template <>
+std::string make_value<std::string>()
+{
+    return std::string(64, 'p');
+}
+
+template <>
+std::vector<int> make_value<std::vector<int>>()
+{
+    return std::vector<int>(256, 42);
+}
+
+template <>
+pod_4k make_value<pod_4k>()
+{
+    pod_4k value {};
+    value.bytes.fill(std::byte { 42 });
+    return value;
+}
+
+/*
+ * Reads something observable from the value, so the benchmark measures an actual load
+ * instead of only an address computation.
+ */
+template <typename T>
+auto probe(const T& value)
+{
+    if constexpr (std::is_arithmetic_v<T>)
+    {
+        return value;
+    }
+    else if constexpr (std::is_same_v<T, pod_4k>)
+    {
+        return value.bytes[0];
+    }
+    else
+    {
+        return value.size();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// The owners, one per access flavour.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+struct property_owner
+{
+    util::property<property_owner, T, util::public_get_set> value { make_value<T>() };
+
+    const T& get()
+    {
+        return value;
+    }
+
+    void set(const T& new_value)
+    {
+        value = new_value;
+    }
+
+    void increment()
+    {
+        value++;
+    }
+};
+
+template <typename T>
+struct raw_owner
+{
+    T value { make_value<T>() };
+
+    const T& get()
+    {
+        return value;
+    }
+
+    void set(const T& new_value)
+    {
+        value = new_value;
+    }
+
+    void increment()
+    {
+        value++;
+    }
+};
+
+template <typename T>
+class accessor_owner
+{
+public:
+    [[nodiscard]] const T& get_value() const noexcept
+    {
+        return m_value;
+    }
+
+    void set_value(const T& value)
+    {
+        m_value = value;
+    }
+
+    const T& get()
+    {
+        return get_value();
+    }
+
+    void set(const T& new_value)
+    {
+        set_value(new_value);
+    }
+
+    void increment()
+    {
+        set_value(get_value() + 1);
+    }
+
+private:
+    T m_value { make_value<T>() };
+};
+
+/*
+ * The owners of several small properties, used to measure container relocation.
+ */
+template <typename T>
+struct property_record
+{
+    util::property<property_record, T, util::public_get_set> first { make_value<T>() };
+    util::property<property_record, T, util::public_get_set> second { make_value<T>() };
+    util::property<property_record, T, util::public_get> third { make_value<T>() };
+    util::property<property_record, T> fourth { make_value<T>() };
+};
+
+template <typename T>
+struct raw_record
+{
+    T first { make_value<T>() };
+    T second { make_value<T>() };
+    T third { make_value<T>() };
+    T fourth { make_value<T>() };
+};
+
+/*
+ * The owners of two counters, which are bumped by different threads.
+ */
+struct adjacent_counters
+{
+    util::property<adjacent_counters, long, util::public_get_set, util::atomic> first;
+    util::property<adjacent_counters, long, util::public_get_set, util::atomic> second;
+};
+
+struct isolated_counters
+{
+    template <class T>
+    using counter_t = util::property<isolated_counters, T, util::public_get_set,
+                                     util::cache_aligned<util::atomic>>;
+
+    counter_t<long> first;
+    counter_t<long> second;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// The benchmarks.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename TOwner>
+void bm_read(benchmark::State& state)
+{
+    TOwner owner;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(probe(owner.get()));
+        benchmark::ClobberMemory();
+    }
+}
+
+template <typename TOwner>
+void bm_write(benchmark::State& state)
+{
+    TOwner owner;
+    const auto value = owner.get();
+    for (auto _ : state)
+    {
+        owner.set(value);
+        benchmark::ClobberMemory();
+    }
+}
+
+template <typename TOwner>
+void bm_copy(benchmark::State& state)
+{
+    TOwner owner;
+    for (auto _ : state)
+    {
+        TOwner copy { owner };
+        benchmark::DoNotOptimize(copy);
+    }
+}
+
+template <typename TOwner>
+void bm_move(benchmark::State& state)
+{
+    TOwner owner;
+    for (auto _ : state)
+    {
+        TOwner moved { std::move(owner) };
+        benchmark::DoNotOptimize(moved);
+        owner = std::move(moved);
+    }
+}
+
+template <typename TOwner>
+void bm_increment(benchmark::State& state)
+{
+    TOwner owner;
+    for (auto _ : state)
+    {
+        owner.increment();
+        benchmark::ClobberMemory();
+    }
+}
+
+template <typename TRecord>
+void bm_vector_growth(benchmark::State& state)
+{
+    const TRecord record;
+    for (auto _ : state)
+    {
+        std::vector<TRecord> records;
+        for (std::int64_t i = 0; i < state.range(0); ++i)
+        {
+            records.push_back(record);
+        }
+        benchmark::DoNotOptimize(records.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename TCounters>
+void bm_neighbour_counters(benchmark::State& state)
+{
+    static TCounters counters;
+    auto& counter = state.thread_index() % 2 == 0 ? counters.first : counters.second;
+    for (auto _ : state)
+    {
+        counter.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+} // namespace
+
+#define PROPERTY_BENCHMARK_OWNERS(bm, TValue)                                                     \
+    BENCHMARK_TEMPLATE(bm, raw_owner<TValue>);                                                    \
+    BENCHMARK_TEMPLATE(bm, accessor_owner<TValue>);                                               \
+    BENCHMARK_TEMPLATE(bm, property_owner<TValue>)
+
+#define PROPERTY_BENCHMARK_VALUE(TValue)                                                          \
+    PROPERTY_BENCHMARK_OWNERS(bm_read, TValue);                                                   \
+    PROPERTY_BENCHMARK_OWNERS(bm_write, TValue);                                                  \
+    PROPERTY_BENCHMARK_OWNERS(bm_copy, TValue);                                                   \
+    PROPERTY_BENCHMARK_OWNERS(bm_move, TValue)
+
+PROPERTY_BENCHMARK_VALUE(int);
+PROPERTY_BENCHMARK_VALUE(double);
+PROPERTY_BENCHMARK_VALUE(std::string);
+PROPERTY_BENCHMARK_VALUE(std::vector<int>);
+PROPERTY_BENCHMARK_VALUE(pod_4k);
+
+PROPERTY_BENCHMARK_OWNERS(bm_increment, int);
+PROPERTY_BENCHMARK_OWNERS(bm_increment, double);
+
+BENCHMARK_TEMPLATE(bm_vector_growth, raw_record<int>)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(bm_vector_growth, property_record<int>)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(bm_vector_growth, raw_record<std::string>)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(bm_vector_growth, property_record<std::string>)->Arg(1 << 12);
+
+BENCHMARK_TEMPLATE(bm_neighbour_counters, adjacent_counters)->Threads(2)->UseRealTime();
+BENCHMARK_TEMPLATE(bm_neighbour_counters, isolated_counters)->Threads(2)->UseRealTime();
+
+BENCHMARK_MAIN();
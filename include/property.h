@@ -9,6 +9,11 @@
 #ifndef PROPERTY_PROPERTY_H
 #define PROPERTY_PROPERTY_H
 
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 namespace util {
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -36,6 +41,19 @@ class public_get_set
 { };
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// The storage policies.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Store the value as an ordinary data member.
+ * The other storage policies are declared in their own headers, e.g. util::atomic in
+ * property_atomic.h.
+ */
+class plain
+{ };
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 namespace impl {
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -54,16 +72,24 @@ template <typename T>
 class data_storage
 {
 protected:
-    explicit data_storage(T&& value) noexcept(noexcept(T{std::forward<T>(value)}))
-        : m_value { std::forward<T>(value) }
+    /**
+     * Constructs the value directly inside the storage, without temporary objects.
+     */
+    template <typename... TArgs>
+    explicit data_storage(std::in_place_t, TArgs&&... args)
+        noexcept(std::is_nothrow_constructible_v<T, TArgs...>)
+        : m_value(std::forward<TArgs>(args)...)
     {
     }
 
-    ~data_storage() noexcept = default;
-    data_storage(data_storage&&) noexcept = default;
-    data_storage(const data_storage&) noexcept = default;
-    data_storage& operator=(data_storage&&) noexcept = default;
-    data_storage& operator=(const data_storage&) noexcept = default;
+    /*
+     * The special members are trivial and noexcept exactly when the ones of the value are.
+     */
+    ~data_storage() = default;
+    data_storage(data_storage&&) = default;
+    data_storage(const data_storage&) = default;
+    data_storage& operator=(data_storage&&) = default;
+    data_storage& operator=(const data_storage&) = default;
 
     [[nodiscard]] T& value() noexcept
     {
@@ -83,6 +109,53 @@ private:
 }; // class data_storage
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+/**
+ * @internal
+ * @class       owner_link
+ * @brief       The internal class owner_link refers to another subobject of the same owner by
+ *              the offset from the property. Unlike a pointer, the link stays valid when the
+ *              owner is copied or moved, because the copy keeps the same layout.
+ *
+ * @tparam T    The type of the referred object.
+ */
+template <typename T>
+class owner_link
+{
+public:
+    owner_link(const void* self, const T& target) noexcept
+        : m_offset { static_cast<std::ptrdiff_t>(reinterpret_cast<std::uintptr_t>(&target)
+                                                 - reinterpret_cast<std::uintptr_t>(self)) }
+    {
+    }
+
+    [[nodiscard]] T& get(const void* self) const noexcept
+    {
+        return *reinterpret_cast<T*>(reinterpret_cast<std::uintptr_t>(self) + m_offset);
+    }
+
+private:
+    /*
+     * The offset of the referred object from the property.
+     */
+    std::ptrdiff_t m_offset;
+}; // class owner_link
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @internal
+ * @brief       The library containers, which copy whole owners, reach the values of the plain
+ *              properties through this class, regardless of their access policies.
+ */
+struct property_access
+{
+    template <typename TProperty>
+    [[nodiscard]] static constexpr auto& value(TProperty& property) noexcept
+    {
+        return property.value();
+    }
+};
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helper concepts.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -94,6 +167,25 @@ concept is_access_policy =
     || std::is_same_v<T, public_get_set>
 ;
 
+template <typename TAccessPolicy>
+inline constexpr bool is_public_get = std::is_same_v<TAccessPolicy, public_get>
+                                   || std::is_same_v<TAccessPolicy, public_get_set>;
+
+template <typename TAccessPolicy>
+inline constexpr bool is_public_set = std::is_same_v<TAccessPolicy, public_get_set>;
+
+/*
+ * The storage policy headers enable their policies by specializing this variable.
+ */
+template <typename T>
+inline constexpr bool enable_storage_policy = false;
+
+template <>
+inline constexpr bool enable_storage_policy<plain> = true;
+
+template<typename T>
+concept is_storage_policy = enable_storage_policy<T>;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
@@ -139,27 +231,96 @@ concept is_access_policy =
  *                     -# public_get_set - Declare only a public get and set accessors.
  *                     -# private_get_set - Declare only a private get and set accessors.
  *                 The param is optional default value is private_get_set.
+ * @tparam TStoragePolicy is the storage policy for the value.
+ *                 Possible variants
+ *                     -# plain - Store the value as an ordinary data member.
+ *                     -# atomic - Store the value as std::atomic (property_atomic.h).
+ *                     -# seqlock - Store the value behind a sequence lock (property_seqlock.h).
+ *                     -# snapshot - Store immutable versions of the value (property_snapshot.h).
+ *                     -# cache_aligned<TStoragePolicy> - Place the property on its own cache
+ *                        line (property_cache_aligned.h).
+ *                     -# sharded<TShardCount> - Store a counter as per-thread shards
+ *                        (property_sharded.h).
+ *                     -# observable<TCapacity> - Notify subscribers about the writes
+ *                        (property_observable.h).
+ *                     -# tracked<TIndex> - Mark the property in the owner dirty_set on writes
+ *                        (property_tracked.h).
+ *                     -# computed<TCompute> - Compute the value lazily and cache it
+ *                        (property_computed.h).
+ *                     -# input, derived<TCompute> - Recompute the derived properties when
+ *                        their sources change (property_graph.h).
+ *                     -# journaled<TIndex> - Append the assignments to the journal of the owner
+ *                        (property_journal.h).
+ *                     -# undoable - Record the assignments in the undo/redo history of the owner
+ *                        (property_history.h).
+ *                     -# versioned - Keep the committed versions, write by the transactions
+ *                        (property_versioned.h).
+ *                     -# copy_on_write - Share the value between the copies, clone it on writes
+ *                        (property_copy_on_write.h).
+ *                     -# polymorphic<TSize, TAlign> - Hold an object derived from the value
+ *                        type inline or in an arena (property_polymorphic.h).
+ *                 The param is optional default value is plain.
  */
-template <typename TOwner, typename TValue, typename TAccessPolicy = private_get_set>
-    requires(impl::is_access_policy<TAccessPolicy>)
+template <typename TOwner, typename TValue, typename TAccessPolicy = private_get_set,
+          typename TStoragePolicy = plain>
+    requires(impl::is_access_policy<TAccessPolicy> && impl::is_storage_policy<TStoragePolicy>)
 class property : private impl::data_storage<TValue>
 {
     friend TOwner;
-    static constexpr bool is_public_get = std::is_same_v<TAccessPolicy, public_get>
-                                       || std::is_same_v<TAccessPolicy, public_get_set>;
-    static constexpr bool is_public_set = std::is_same_v<TAccessPolicy, public_get_set>;
+    friend impl::property_access;
+
+    /*
+     * The wrapping storage policies (e.g. cache_aligned) forward to the wrapped property.
+     */
+    template <typename, typename, typename TOtherAccessPolicy, typename TOtherStoragePolicy>
+        requires(impl::is_access_policy<TOtherAccessPolicy>
+                 && impl::is_storage_policy<TOtherStoragePolicy>)
+    friend class property;
+
+    static constexpr bool is_public_get = impl::is_public_get<TAccessPolicy>;
+    static constexpr bool is_public_set = impl::is_public_set<TAccessPolicy>;
+
+    /*
+     * The types, except the value and the property itself, which can be assigned to the value
+     * directly, without constructing a temporary value.
+     */
+    template <typename TOther>
+    static constexpr bool is_assignable_from = !std::is_same_v<std::remove_cvref_t<TOther>, TValue>
+                                            && !std::is_same_v<std::remove_cvref_t<TOther>, property>
+                                            && std::is_assignable_v<TValue&, TOther>;
 
 public:
-    property(TValue value = TValue {}) noexcept(noexcept(TValue{std::forward<TValue>(value)}))
-        : impl::data_storage<TValue> { std::move(value) }
+    property() noexcept(std::is_nothrow_default_constructible_v<TValue>)
+        requires(std::is_default_constructible_v<TValue>)
+        : impl::data_storage<TValue> { std::in_place }
+    {
+    }
+
+    property(TValue value) noexcept(std::is_nothrow_move_constructible_v<TValue>)
+        requires(std::is_move_constructible_v<TValue>)
+        : impl::data_storage<TValue> { std::in_place, std::move(value) }
     {
     }
 
-    ~property() noexcept = default;
-    property(property&&) noexcept = default;
-    property(const property&) noexcept = default;
-    property& operator=(property&&) noexcept = default;
-    property& operator=(const property&) noexcept = default;
+    /**
+     * Constructs the value in place from the given arguments, the value type does not have
+     * to be movable.
+     *
+     * @param args The arguments forwarded to the value constructor.
+     */
+    template <typename... TArgs>
+        requires(std::is_constructible_v<TValue, TArgs...>)
+    explicit property(std::in_place_t, TArgs&&... args)
+        noexcept(std::is_nothrow_constructible_v<TValue, TArgs...>)
+        : impl::data_storage<TValue> { std::in_place, std::forward<TArgs>(args)... }
+    {
+    }
+
+    ~property() = default;
+    property(property&&) = default;
+    property(const property&) = default;
+    property& operator=(property&&) = default;
+    property& operator=(const property&) = default;
 
 public:
     operator TValue&() requires(is_public_get && is_public_set)
@@ -185,11 +346,35 @@ public:
         return this->value() = new_value;
     }
 
+    TValue& operator=(TValue&& new_value) requires(is_public_set)
+    {
+        return this->value() = std::move(new_value);
+    }
+
+    template <typename TOther>
+        requires(is_public_set && is_assignable_from<TOther>)
+    TValue& operator=(TOther&& new_value)
+    {
+        return this->value() = std::forward<TOther>(new_value);
+    }
+
 private:
     TValue& operator=(const TValue& new_value) requires(!is_public_set)
     {
         return this->value() = new_value;
     }
+
+    TValue& operator=(TValue&& new_value) requires(!is_public_set)
+    {
+        return this->value() = std::move(new_value);
+    }
+
+    template <typename TOther>
+        requires(!is_public_set && is_assignable_from<TOther>)
+    TValue& operator=(TOther&& new_value)
+    {
+        return this->value() = std::forward<TOther>(new_value);
+    }
 }; // class property
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
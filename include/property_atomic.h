@@ -0,0 +1,274 @@
+/**
+ * @file        property_atomic.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of the atomic storage policy of property class.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef PROPERTY_PROPERTY_ATOMIC_H
+#define PROPERTY_PROPERTY_ATOMIC_H
+
+#include <atomic>
+#include <type_traits>
+#include <utility>
+
+#include "property.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace util {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Store the value as lock-free std::atomic, so it can be accessed by several threads
+ * without external synchronization.
+ */
+class atomic
+{ };
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <>
+inline constexpr bool enable_storage_policy<atomic> = true;
+
+template <typename T>
+concept has_atomic_fetch_add = requires(std::atomic<T>& value, T arg)
+{
+    value.fetch_add(arg);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @class          property
+ * @brief          The property specialization which stores the value as std::atomic.
+ * @details        The read accessors (load and the conversion operator) follow the get part
+ *                 of the access policy, all modifying accessors (store, exchange,
+ *                 compare_exchange_*, fetch_add, fetch_sub, increments and decrements) follow
+ *                 the set part. Every accessor takes an explicit memory order, the default one
+ *                 is std::memory_order_seq_cst.
+ *                 Copying the property copies a snapshot of the value, the copy is not atomic
+ *                 with respect to the concurrent writes of the source.
+ * @example        struct worker
+ *                 {
+ *                     // Anyone can read, only the worker bumps the counter.
+ *                     util::property<worker, long, util::public_get, util::atomic> processed;
+ *                     void on_done() { processed.fetch_add(1, std::memory_order_relaxed); }
+ *                 };
+ *                 long done = w.processed.load(std::memory_order_relaxed);
+ * @tparam TOwner  is the type of owner, which should have all accesses.
+ * @tparam TValue  is the type of property value, std::atomic<TValue> should be lock-free.
+ * @tparam TAccessPolicy is the access policy for the property.
+ */
+template <typename TOwner, typename TValue, typename TAccessPolicy>
+class property<TOwner, TValue, TAccessPolicy, atomic>
+    : private impl::data_storage<std::atomic<TValue>>
+{
+    static_assert(std::atomic<TValue>::is_always_lock_free,
+                  "The atomic storage policy requires a lock-free value type.");
+
+    friend TOwner;
+
+    /*
+     * The wrapping storage policies (e.g. cache_aligned) forward to the wrapped property.
+     */
+    template <typename, typename, typename TOtherAccessPolicy, typename TOtherStoragePolicy>
+        requires(impl::is_access_policy<TOtherAccessPolicy>
+                 && impl::is_storage_policy<TOtherStoragePolicy>)
+    friend class property;
+
+    static constexpr bool is_public_get = impl::is_public_get<TAccessPolicy>;
+    static constexpr bool is_public_set = impl::is_public_set<TAccessPolicy>;
+    static constexpr auto seq_cst = std::memory_order_seq_cst;
+    using storage_type = impl::data_storage<std::atomic<TValue>>;
+
+public:
+    property() noexcept
+        : storage_type { std::in_place }
+    {
+    }
+
+    property(TValue value) noexcept
+        : storage_type { std::in_place, value }
+    {
+    }
+
+    property(const property& other) noexcept
+        : storage_type { std::in_place, other.value().load() }
+    {
+    }
+
+    property& operator=(const property& other) noexcept
+    {
+        this->value().store(other.value().load());
+        return *this;
+    }
+
+    ~property() = default;
+
+public:
+    [[nodiscard]] TValue load(std::memory_order order = seq_cst) const noexcept
+        requires(is_public_get)
+    {
+        return this->value().load(order);
+    }
+
+    operator TValue() const noexcept requires(is_public_get)
+    {
+        return this->value().load();
+    }
+
+private:
+    [[nodiscard]] TValue load(std::memory_order order = seq_cst) const noexcept
+        requires(!is_public_get)
+    {
+        return this->value().load(order);
+    }
+
+    operator TValue() const noexcept requires(!is_public_get)
+    {
+        return this->value().load();
+    }
+
+public:
+    void store(TValue new_value, std::memory_order order = seq_cst) noexcept
+        requires(is_public_set)
+    {
+        this->value().store(new_value, order);
+    }
+
+    TValue operator=(TValue new_value) noexcept requires(is_public_set)
+    {
+        return this->value() = new_value;
+    }
+
+    TValue exchange(TValue new_value, std::memory_order order = seq_cst) noexcept
+        requires(is_public_set)
+    {
+        return this->value().exchange(new_value, order);
+    }
+
+    bool compare_exchange_weak(TValue& expected, TValue desired,
+                               std::memory_order success = seq_cst,
+                               std::memory_order failure = seq_cst) noexcept
+        requires(is_public_set)
+    {
+        return this->value().compare_exchange_weak(expected, desired, success, failure);
+    }
+
+    bool compare_exchange_strong(TValue& expected, TValue desired,
+                                 std::memory_order success = seq_cst,
+                                 std::memory_order failure = seq_cst) noexcept
+        requires(is_public_set)
+    {
+        return this->value().compare_exchange_strong(expected, desired, success, failure);
+    }
+
+    TValue fetch_add(TValue arg, std::memory_order order = seq_cst) noexcept
+        requires(is_public_set && impl::has_atomic_fetch_add<TValue>)
+    {
+        return this->value().fetch_add(arg, order);
+    }
+
+    TValue fetch_sub(TValue arg, std::memory_order order = seq_cst) noexcept
+        requires(is_public_set && impl::has_atomic_fetch_add<TValue>)
+    {
+        return this->value().fetch_sub(arg, order);
+    }
+
+    TValue operator++() noexcept requires(is_public_set && std::is_integral_v<TValue>)
+    {
+        return ++this->value();
+    }
+
+    TValue operator++(int) noexcept requires(is_public_set && std::is_integral_v<TValue>)
+    {
+        return this->value()++;
+    }
+
+    TValue operator--() noexcept requires(is_public_set && std::is_integral_v<TValue>)
+    {
+        return --this->value();
+    }
+
+    TValue operator--(int) noexcept requires(is_public_set && std::is_integral_v<TValue>)
+    {
+        return this->value()--;
+    }
+
+private:
+    void store(TValue new_value, std::memory_order order = seq_cst) noexcept
+        requires(!is_public_set)
+    {
+        this->value().store(new_value, order);
+    }
+
+    TValue operator=(TValue new_value) noexcept requires(!is_public_set)
+    {
+        return this->value() = new_value;
+    }
+
+    TValue exchange(TValue new_value, std::memory_order order = seq_cst) noexcept
+        requires(!is_public_set)
+    {
+        return this->value().exchange(new_value, order);
+    }
+
+    bool compare_exchange_weak(TValue& expected, TValue desired,
+                               std::memory_order success = seq_cst,
+                               std::memory_order failure = seq_cst) noexcept
+        requires(!is_public_set)
+    {
+        return this->value().compare_exchange_weak(expected, desired, success, failure);
+    }
+
+    bool compare_exchange_strong(TValue& expected, TValue desired,
+                                 std::memory_order success = seq_cst,
+                                 std::memory_order failure = seq_cst) noexcept
+        requires(!is_public_set)
+    {
+        return this->value().compare_exchange_strong(expected, desired, success, failure);
+    }
+
+    TValue fetch_add(TValue arg, std::memory_order order = seq_cst) noexcept
+        requires(!is_public_set && impl::has_atomic_fetch_add<TValue>)
+    {
+        return this->value().fetch_add(arg, order);
+    }
+
+    TValue fetch_sub(TValue arg, std::memory_order order = seq_cst) noexcept
+        requires(!is_public_set && impl::has_atomic_fetch_add<TValue>)
+    {
+        return this->value().fetch_sub(arg, order);
+    }
+
+    TValue operator++() noexcept requires(!is_public_set && std::is_integral_v<TValue>)
+    {
+        return ++this->value();
+    }
+
+    TValue operator++(int) noexcept requires(!is_public_set && std::is_integral_v<TValue>)
+    {
+        return this->value()++;
+    }
+
+    TValue operator--() noexcept requires(!is_public_set && std::is_integral_v<TValue>)
+    {
+        return --this->value();
+    }
+
+    TValue operator--(int) noexcept requires(!is_public_set && std::is_integral_v<TValue>)
+    {
+        return this->value()--;
+    }
+}; // class property<TOwner, TValue, TAccessPolicy, atomic>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace util
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // PROPERTY_PROPERTY_ATOMIC_H
@@ -0,0 +1,133 @@
+/**
+ * @file        property_cache_aligned.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of the cache_aligned storage policy of property
+ *              class.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef PROPERTY_PROPERTY_CACHE_ALIGNED_H
+#define PROPERTY_PROPERTY_CACHE_ALIGNED_H
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "property.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace util {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Place the property on its own cache line, so the writes to it do not invalidate the
+ * neighbouring members of the owner (false sharing). Wraps another storage policy.
+ *
+ * @tparam TStoragePolicy The storage policy of the wrapped value, the default is plain.
+ */
+template <typename TStoragePolicy = plain>
+class cache_aligned
+{ };
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename TStoragePolicy>
+inline constexpr bool enable_storage_policy<cache_aligned<TStoragePolicy>> =
+    enable_storage_policy<TStoragePolicy>;
+
+/**
+ * @internal
+ * @brief       The minimum offset between two objects to avoid false sharing.
+ */
+#ifdef __cpp_lib_hardware_interference_size
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winterference-size"
+#endif
+inline constexpr std::size_t destructive_interference_size =
+    std::hardware_destructive_interference_size;
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#else
+inline constexpr std::size_t destructive_interference_size = 64;
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @class          property
+ * @brief          The property specialization which occupies whole cache lines.
+ * @details        The property is aligned to and padded up to the destructive interference
+ *                 size, otherwise it behaves exactly as the property with the wrapped storage
+ *                 policy, including the access policy.
+ * @example        struct worker
+ *                 {
+ *                     template <class T>
+ *                     using counter_t = util::property<worker, T, util::public_get,
+ *                                                      util::cache_aligned<util::atomic>>;
+ *                     // The counters are bumped by different threads.
+ *                     counter_t<long> received;
+ *                     counter_t<long> processed;
+ *                 };
+ * @tparam TOwner  is the type of owner, which should have all accesses.
+ * @tparam TValue  is the type of property value.
+ * @tparam TAccessPolicy is the access policy for the property.
+ * @tparam TStoragePolicy is the wrapped storage policy.
+ */
+template <typename TOwner, typename TValue, typename TAccessPolicy, typename TStoragePolicy>
+class alignas(impl::destructive_interference_size)
+    property<TOwner, TValue, TAccessPolicy, cache_aligned<TStoragePolicy>>
+    : public property<TOwner, TValue, TAccessPolicy, TStoragePolicy>
+{
+    friend TOwner;
+    static constexpr bool is_public_set = impl::is_public_set<TAccessPolicy>;
+    using base_type = property<TOwner, TValue, TAccessPolicy, TStoragePolicy>;
+
+    /*
+     * The assignment is forwarded to the wrapped property, except the copy and move of the
+     * property itself.
+     */
+    template <typename TOther>
+    static constexpr bool is_assignable_from =
+        !std::is_same_v<std::remove_cvref_t<TOther>, property>
+        && std::is_assignable_v<TValue&, TOther>;
+
+public:
+    using base_type::base_type;
+
+    property() = default;
+    ~property() = default;
+    property(property&&) = default;
+    property(const property&) = default;
+    property& operator=(property&&) = default;
+    property& operator=(const property&) = default;
+
+public:
+    template <typename TOther>
+        requires(is_public_set && is_assignable_from<TOther>)
+    decltype(auto) operator=(TOther&& new_value)
+    {
+        return base_type::operator=(std::forward<TOther>(new_value));
+    }
+
+private:
+    template <typename TOther>
+        requires(!is_public_set && is_assignable_from<TOther>)
+    decltype(auto) operator=(TOther&& new_value)
+    {
+        return base_type::operator=(std::forward<TOther>(new_value));
+    }
+}; // class property<TOwner, TValue, TAccessPolicy, cache_aligned<TStoragePolicy>>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace util
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // PROPERTY_PROPERTY_CACHE_ALIGNED_H
@@ -0,0 +1,217 @@
+/**
+ * @file        property_computed.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of the computed storage policy of property class.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef PROPERTY_PROPERTY_COMPUTED_H
+#define PROPERTY_PROPERTY_COMPUTED_H
+
+#include <functional>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "property.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace util {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Compute the value from the owner on the first read and cache it until the invalidation.
+ *
+ * @tparam TCompute The compute function, invocable with the constant owner, e.g. a pointer to
+ *                  a constant member function of the owner.
+ */
+template <auto TCompute>
+class computed
+{ };
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <auto TCompute>
+inline constexpr bool enable_storage_policy<computed<TCompute>> = true;
+
+/**
+ * @internal
+ * @class       computed_storage
+ * @brief       The internal class computed_storage keeps the cached value and the link to the
+ *              owner, which computes it.
+ *
+ * @tparam TOwner   The owner type.
+ * @tparam T        The value type.
+ * @tparam TCompute The compute function.
+ */
+template <typename TOwner, typename T, auto TCompute>
+class computed_storage
+{
+protected:
+    explicit computed_storage(const TOwner& owner) noexcept
+        : m_owner { this, owner }
+    {
+    }
+
+    /*
+     * The copy of the owner has the same inputs, so the cached value stays valid.
+     */
+    ~computed_storage() = default;
+    computed_storage(computed_storage&&) = default;
+    computed_storage(const computed_storage&) = default;
+
+    /*
+     * The assignment keeps the inputs of the owner, so it drops the cached value.
+     */
+    computed_storage& operator=(const computed_storage&) noexcept
+    {
+        invalidate();
+        return *this;
+    }
+
+    [[nodiscard]] const T& value() const
+    {
+        if (!m_cache.has_value())
+        {
+            m_cache.emplace(std::invoke(TCompute, std::as_const(m_owner.get(this))));
+        }
+        return *m_cache;
+    }
+
+    [[nodiscard]] bool is_cached() const noexcept
+    {
+        return m_cache.has_value();
+    }
+
+    void invalidate() noexcept
+    {
+        m_cache.reset();
+    }
+
+private:
+    /*
+     * The owner, which provides the inputs of the compute function.
+     */
+    owner_link<TOwner> m_owner;
+
+    /*
+     * The value computed since the last invalidation, if any.
+     */
+    mutable std::optional<T> m_cache;
+}; // class computed_storage
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @class          property
+ * @brief          The property specialization which computes the value lazily from the owner.
+ * @details        The first read calls the compute function with the owner and caches the
+ *                 result, the next reads return the cached value until the invalidation. The
+ *                 reads follow the get part of the access policy, the invalidation follows the
+ *                 set part. The property is constructed with the owner and refers to it by the
+ *                 offset, so the copies of the owner refer to themselves. The cache is not
+ *                 synchronized, like the value of the plain property.
+ * @example        struct shape
+ *                 {
+ *                     std::vector<point> points;
+ *                     box compute_bounds() const;
+ *                     util::property<shape, box, util::public_get,
+ *                                    util::computed<&shape::compute_bounds>> bounds { *this };
+ *                     void add(point p) { points.push_back(p); bounds.invalidate(); }
+ *                 };
+ *                 box b = s.bounds; // Computed once, until the next add.
+ * @tparam TOwner  is the type of owner, which should have all accesses.
+ * @tparam TValue  is the type of property value, the result of the compute function.
+ * @tparam TAccessPolicy is the access policy for the property.
+ * @tparam TCompute is the compute function.
+ */
+template <typename TOwner, typename TValue, typename TAccessPolicy, auto TCompute>
+class property<TOwner, TValue, TAccessPolicy, computed<TCompute>>
+    : private impl::computed_storage<TOwner, TValue, TCompute>
+{
+    friend TOwner;
+
+    /*
+     * The wrapping storage policies (e.g. cache_aligned) forward to the wrapped property.
+     */
+    template <typename, typename, typename TOtherAccessPolicy, typename TOtherStoragePolicy>
+        requires(impl::is_access_policy<TOtherAccessPolicy>
+                 && impl::is_storage_policy<TOtherStoragePolicy>)
+    friend class property;
+
+    static constexpr bool is_public_get = impl::is_public_get<TAccessPolicy>;
+    static constexpr bool is_public_set = impl::is_public_set<TAccessPolicy>;
+    using storage_type = impl::computed_storage<TOwner, TValue, TCompute>;
+
+public:
+    explicit property(const TOwner& owner) noexcept
+        : storage_type { owner }
+    {
+    }
+
+    ~property() = default;
+    property& operator=(const property&) = default;
+
+private:
+    /*
+     * The copy keeps the offset to the owner, which is valid only in the copy of the owner, so
+     * only the owner copies the property.
+     */
+    property(property&&) = default;
+    property(const property&) = default;
+
+public:
+    [[nodiscard]] const TValue& get() const requires(is_public_get)
+    {
+        return storage_type::value();
+    }
+
+    operator const TValue&() const requires(is_public_get)
+    {
+        return storage_type::value();
+    }
+
+    [[nodiscard]] bool is_cached() const noexcept requires(is_public_get)
+    {
+        return storage_type::is_cached();
+    }
+
+private:
+    [[nodiscard]] const TValue& get() const requires(!is_public_get)
+    {
+        return storage_type::value();
+    }
+
+    operator const TValue&() const requires(!is_public_get)
+    {
+        return storage_type::value();
+    }
+
+    [[nodiscard]] bool is_cached() const noexcept requires(!is_public_get)
+    {
+        return storage_type::is_cached();
+    }
+
+public:
+    void invalidate() noexcept requires(is_public_set)
+    {
+        storage_type::invalidate();
+    }
+
+private:
+    void invalidate() noexcept requires(!is_public_set)
+    {
+        storage_type::invalidate();
+    }
+}; // class property<TOwner, TValue, TAccessPolicy, computed<TCompute>>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace util
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // PROPERTY_PROPERTY_COMPUTED_H
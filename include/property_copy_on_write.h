@@ -0,0 +1,364 @@
+/**
+ * @file        property_copy_on_write.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of the copy_on_write storage policy of property
+ *              class.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef PROPERTY_PROPERTY_COPY_ON_WRITE_H
+#define PROPERTY_PROPERTY_COPY_ON_WRITE_H
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "property.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace util {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Share the value between the copies of the owner and clone it on the first mutation.
+ */
+class copy_on_write
+{ };
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <>
+inline constexpr bool enable_storage_policy<copy_on_write> = true;
+
+/**
+ * @internal
+ * @class       shared_storage
+ * @brief       The internal class shared_storage keeps the value in a heap block with the
+ *              reference count, the copies of the storage share the block.
+ * @details     The count is atomic, so the copies sharing a block may be used from different
+ *              threads, as long as each copy is used by one thread at a time. Once a mutable
+ *              reference to the value is handed out by mutable_value, the block is no longer
+ *              shared: the reference may be used after the uniqueness check, so the later copies
+ *              clone it.
+ *
+ * @tparam T    The value type.
+ */
+template <typename T>
+class shared_storage
+{
+    struct block
+    {
+        template <typename... TArgs>
+        explicit block(TArgs&&... args)
+            : value(std::forward<TArgs>(args)...)
+        {
+        }
+
+        std::atomic<std::size_t> references { 1 };
+        bool shareable = true;
+        T value;
+    };
+
+protected:
+    template <typename... TArgs>
+    explicit shared_storage(std::in_place_t, TArgs&&... args)
+        : m_block { new block { std::forward<TArgs>(args)... } }
+    {
+    }
+
+    /*
+     * The copies share the block, so copying the owner does not copy the value.
+     */
+    shared_storage(const shared_storage& other)
+        : m_block { other.share() }
+    {
+    }
+
+    shared_storage& operator=(const shared_storage& other)
+    {
+        if (m_block != other.m_block)
+        {
+            auto* new_block = other.share();
+            release();
+            m_block = new_block;
+        }
+        return *this;
+    }
+
+    ~shared_storage()
+    {
+        release();
+    }
+
+    /**
+     * The value for reading, the block stays shared.
+     */
+    [[nodiscard]] const T& value() const noexcept
+    {
+        return m_block->value;
+    }
+
+    /**
+     * The value for writing, the shared block is cloned first. The reference should not outlive
+     * the write, since the block stays shareable.
+     */
+    [[nodiscard]] T& unique_value()
+    {
+        if (is_shared())
+        {
+            return replace(m_block->value);
+        }
+        return m_block->value;
+    }
+
+    /**
+     * The value for writing, which may be kept by the caller, so the block is not shared after.
+     */
+    [[nodiscard]] T& mutable_value()
+    {
+        auto& value = unique_value();
+        m_block->shareable = false;
+        return value;
+    }
+
+    /**
+     * Replaces the block with the new one, constructed from the arguments. Unlike unique_value,
+     * the shared value is not cloned.
+     */
+    template <typename... TArgs>
+    T& replace(TArgs&&... args)
+    {
+        auto* new_block = new block { std::forward<TArgs>(args)... };
+        release();
+        m_block = new_block;
+        return m_block->value;
+    }
+
+    [[nodiscard]] bool is_shared() const noexcept
+    {
+        // The acquire pairs with the release of the other owners, their writes happen before
+        // the reuse of the block.
+        return m_block->references.load(std::memory_order_acquire) != 1;
+    }
+
+    [[nodiscard]] std::size_t use_count() const noexcept
+    {
+        return m_block->references.load(std::memory_order_relaxed);
+    }
+
+private:
+    /**
+     * The block for a copy of the storage, the same block, or its clone if a mutable reference
+     * has been handed out.
+     */
+    [[nodiscard]] block* share() const
+    {
+        if (!m_block->shareable)
+        {
+            return new block { std::as_const(m_block->value) };
+        }
+        m_block->references.fetch_add(1, std::memory_order_relaxed);
+        return m_block;
+    }
+
+    void release() noexcept
+    {
+        if (m_block->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            delete m_block;
+        }
+    }
+
+private:
+    block* m_block;
+}; // class shared_storage
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @class          property
+ * @brief          The property specialization which shares the value between the copies.
+ * @details        Copying the property, and so the owner, only bumps the reference count of the
+ *                 value block. The mutable conversion operator and the assignments give the
+ *                 property its own block first: the conversion clones the shared value, the
+ *                 assignments construct the new value without cloning the old one. Since the
+ *                 conversion returns a mutable reference, the value is cloned, not shared, by the
+ *                 later copies of the property; the assignments return a constant reference and
+ *                 keep the value shareable. The reads through get() never clone. The moves are
+ *                 copies, so the moved from property keeps its value.
+ * @example        struct document
+ *                 {
+ *                     template <class T>
+ *                     using property_t = util::property<document, T, util::public_get_set,
+ *                                                       util::copy_on_write>;
+ *                     property_t<std::vector<std::byte>> blob;
+ *                 };
+ *                 document copy = original;              // Shares the blob.
+ *                 static_cast<std::vector<std::byte>&>(copy.blob).push_back(std::byte { 0 });
+ *                                                        // Clones the blob.
+ * @tparam TOwner  is the type of owner, which should have all accesses.
+ * @tparam TValue  is the type of property value, should be copy constructible.
+ * @tparam TAccessPolicy is the access policy for the property.
+ */
+template <typename TOwner, typename TValue, typename TAccessPolicy>
+class property<TOwner, TValue, TAccessPolicy, copy_on_write>
+    : private impl::shared_storage<TValue>
+{
+    static_assert(std::is_copy_constructible_v<TValue>,
+                  "The copy_on_write storage policy requires a copy constructible value type.");
+
+    friend TOwner;
+
+    /*
+     * The wrapping storage policies (e.g. cache_aligned) forward to the wrapped property.
+     */
+    template <typename, typename, typename TOtherAccessPolicy, typename TOtherStoragePolicy>
+        requires(impl::is_access_policy<TOtherAccessPolicy>
+                 && impl::is_storage_policy<TOtherStoragePolicy>)
+    friend class property;
+
+    static constexpr bool is_public_get = impl::is_public_get<TAccessPolicy>;
+    static constexpr bool is_public_set = impl::is_public_set<TAccessPolicy>;
+    using storage_type = impl::shared_storage<TValue>;
+
+    template <typename TOther>
+    static constexpr bool is_assignable_from =
+        !std::is_same_v<std::remove_cvref_t<TOther>, TValue>
+        && !std::is_same_v<std::remove_cvref_t<TOther>, property>
+        && std::is_assignable_v<TValue&, TOther>;
+
+public:
+    property() requires(std::is_default_constructible_v<TValue>)
+        : storage_type { std::in_place }
+    {
+    }
+
+    property(TValue value)
+        : storage_type { std::in_place, std::move(value) }
+    {
+    }
+
+    /**
+     * Constructs the value in place from the given arguments.
+     *
+     * @param args The arguments forwarded to the value constructor.
+     */
+    template <typename... TArgs>
+        requires(std::is_constructible_v<TValue, TArgs...>)
+    explicit property(std::in_place_t, TArgs&&... args)
+        : storage_type { std::in_place, std::forward<TArgs>(args)... }
+    {
+    }
+
+    ~property() = default;
+    property(const property&) = default;
+    property& operator=(const property&) = default;
+
+public:
+    /*
+     * The number of the properties sharing the value, for the diagnostics.
+     */
+    using storage_type::use_count;
+    using storage_type::is_shared;
+
+public:
+    /*
+     * Reading through the constant accessor does not clone the value.
+     */
+    [[nodiscard]] const TValue& get() const noexcept requires(is_public_get)
+    {
+        return this->value();
+    }
+
+    operator TValue&() requires(is_public_get && is_public_set)
+    {
+        return this->mutable_value();
+    }
+
+    operator const TValue&() const noexcept requires(is_public_get && !is_public_set)
+    {
+        return this->value();
+    }
+
+private:
+    [[nodiscard]] const TValue& get() const noexcept requires(!is_public_get)
+    {
+        return this->value();
+    }
+
+    operator TValue&() requires(!is_public_get)
+    {
+        return this->mutable_value();
+    }
+
+public:
+    const TValue& operator=(const TValue& new_value) requires(is_public_set)
+    {
+        return assign(new_value);
+    }
+
+    const TValue& operator=(TValue&& new_value) requires(is_public_set)
+    {
+        return assign(std::move(new_value));
+    }
+
+    template <typename TOther>
+        requires(is_public_set && is_assignable_from<TOther>)
+    const TValue& operator=(TOther&& new_value)
+    {
+        return assign(std::forward<TOther>(new_value));
+    }
+
+private:
+    const TValue& operator=(const TValue& new_value) requires(!is_public_set)
+    {
+        return assign(new_value);
+    }
+
+    const TValue& operator=(TValue&& new_value) requires(!is_public_set)
+    {
+        return assign(std::move(new_value));
+    }
+
+    template <typename TOther>
+        requires(!is_public_set && is_assignable_from<TOther>)
+    const TValue& operator=(TOther&& new_value)
+    {
+        return assign(std::forward<TOther>(new_value));
+    }
+
+private:
+    /**
+     * Assigns in place when the value is not shared, otherwise constructs the new block from
+     * the value, so the shared value is not cloned only to be overwritten.
+     */
+    template <typename TOther>
+    const TValue& assign(TOther&& new_value)
+    {
+        if (!this->is_shared())
+        {
+            return this->unique_value() = std::forward<TOther>(new_value);
+        }
+        if constexpr (std::is_constructible_v<TValue, TOther>)
+        {
+            return this->replace(std::forward<TOther>(new_value));
+        }
+        else
+        {
+            return this->unique_value() = std::forward<TOther>(new_value);
+        }
+    }
+}; // class property<TOwner, TValue, TAccessPolicy, copy_on_write>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace util
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // PROPERTY_PROPERTY_COPY_ON_WRITE_H
@@ -0,0 +1,725 @@
+/**
+ * @file        property_graph.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of the input and derived storage policies of
+ *              property class, which form a dependency graph.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef PROPERTY_PROPERTY_GRAPH_H
+#define PROPERTY_PROPERTY_GRAPH_H
+
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "property.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace util {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Store the value as an ordinary data member, which can be a source of the derived properties.
+ * Every write marks the dependent derived properties stale.
+ */
+class input
+{ };
+
+/**
+ * Compute the value from the owner lazily, when it is read after a change of its sources.
+ *
+ * @tparam TCompute The compute function, invocable with the constant owner, e.g. a pointer to
+ *                  a constant member function of the owner.
+ */
+template <auto TCompute>
+class derived
+{ };
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <>
+inline constexpr bool enable_storage_policy<input> = true;
+
+template <auto TCompute>
+inline constexpr bool enable_storage_policy<derived<TCompute>> = true;
+
+/**
+ * @internal
+ * @class       graph_node
+ * @brief       The internal class graph_node is a vertex of the dependency graph.
+ * @details     A write of a source marks its direct dependents dirty and the transitive ones
+ *              to check, stopping at the nodes which are already marked. A read of a marked
+ *              node first brings all its sources up to date, then recomputes the node only if
+ *              one of them has really changed. So each node is recomputed at most once per
+ *              change, after all its sources, and never observes a mix of old and new values.
+ *              The sources are the declared ones and the ones read by the last recompute, which
+ *              are recorded again on every recompute, so the conditional reads are followed.
+ *              The edges are allocated on the first link, the nodes without them take no more
+ *              than a pointer. The copies of a node are not linked, the node unlinks itself on
+ *              destruction.
+ */
+class graph_node
+{
+protected:
+    enum class state : std::uint8_t
+    {
+        clean,
+        check,
+        dirty
+    };
+
+    /*
+     * Recomputes the node, returns whether the value has changed.
+     */
+    using update_function = bool (*)(const graph_node&);
+
+    explicit graph_node(update_function update = nullptr) noexcept
+        : m_update { update }
+        , m_state { update == nullptr ? state::clean : state::dirty }
+    {
+    }
+
+    graph_node(const graph_node& other) noexcept
+        : graph_node { other.m_update }
+    {
+    }
+
+    /*
+     * The assignment keeps the links of the node.
+     */
+    graph_node& operator=(const graph_node&) noexcept
+    {
+        return *this;
+    }
+
+    ~graph_node()
+    {
+        unlink();
+    }
+
+    /**
+     * Declares the edge from the source to this node and marks this node dirty.
+     */
+    void link(graph_node& source)
+    {
+        auto index = find_source(source);
+        if (index == none)
+        {
+            add_source(source);
+            index = m_links->sources.size() - 1;
+        }
+        // The declared sources precede the recorded ones, and are not dropped by recompute.
+        auto& links = *m_links;
+        if (index >= links.declared)
+        {
+            std::swap(links.sources[index], links.sources[links.declared]);
+            ++links.declared;
+        }
+        mark(state::dirty);
+    }
+
+    /**
+     * Removes all edges of this node.
+     */
+    void unlink() noexcept
+    {
+        if (m_links == nullptr)
+        {
+            return;
+        }
+        for (auto* source : m_links->sources)
+        {
+            std::erase(source->m_links->dependents, this);
+        }
+        for (auto* dependent : m_links->dependents)
+        {
+            dependent->remove_source(*this);
+        }
+        m_links.reset();
+    }
+
+    /**
+     * Notifies the dependents that the value of this node has changed.
+     */
+    void changed() noexcept
+    {
+        if (m_links == nullptr)
+        {
+            return;
+        }
+        for (auto* dependent : m_links->dependents)
+        {
+            dependent->mark(state::dirty);
+        }
+    }
+
+    /**
+     * Marks this node stale, so it is recomputed on the next read.
+     */
+    void invalidate() noexcept
+    {
+        mark(state::dirty);
+    }
+
+    /**
+     * Records the read of this node, if it is made by the recompute of another node.
+     */
+    void track() const
+    {
+        if (auto* reader = recording(); reader != nullptr && reader != this)
+        {
+            if (reader->find_source(*this) == none)
+            {
+                reader->add_source(const_cast<graph_node&>(*this));
+            }
+        }
+    }
+
+    /**
+     * Brings the node up to date, recomputing it and its sources only when needed.
+     */
+    void refresh() const
+    {
+        if (m_state == state::check)
+        {
+            // Every source is brought up to date, the changed one marks this node dirty.
+            for (std::size_t i = 0; m_links != nullptr && i != m_links->sources.size(); ++i)
+            {
+                m_links->sources[i]->refresh();
+            }
+        }
+        if (m_state == state::dirty && recompute())
+        {
+            for (auto* dependent : m_links->dependents)
+            {
+                dependent->m_state = state::dirty;
+            }
+        }
+        m_state = state::clean;
+    }
+
+    [[nodiscard]] bool is_stale() const noexcept
+    {
+        return m_state != state::clean;
+    }
+
+private:
+    static constexpr std::size_t none = static_cast<std::size_t>(-1);
+
+    /**
+     * The node, whose recompute is running on the calling thread.
+     */
+    [[nodiscard]] static graph_node*& recording() noexcept
+    {
+        thread_local graph_node* node = nullptr;
+        return node;
+    }
+
+    /**
+     * Drops the recorded sources and recomputes the node, recording the sources it reads.
+     */
+    bool recompute() const
+    {
+        auto& self = const_cast<graph_node&>(*this);
+        self.forget_recorded();
+        auto* previous = std::exchange(recording(), &self);
+        bool is_changed = false;
+        try
+        {
+            is_changed = m_update(*this);
+        }
+        catch (...)
+        {
+            recording() = previous;
+            throw;
+        }
+        recording() = previous;
+        return is_changed && m_links != nullptr;
+    }
+
+    void add_source(graph_node& source)
+    {
+        if (m_links == nullptr)
+        {
+            m_links = std::make_unique<links>();
+        }
+        if (source.m_links == nullptr)
+        {
+            source.m_links = std::make_unique<links>();
+        }
+        m_links->sources.push_back(&source);
+        try
+        {
+            source.m_links->dependents.push_back(this);
+        }
+        catch (...)
+        {
+            m_links->sources.pop_back();
+            throw;
+        }
+    }
+
+    void remove_source(const graph_node& source) noexcept
+    {
+        const auto index = find_source(source);
+        if (index == none)
+        {
+            return;
+        }
+        auto& links = *m_links;
+        if (index < links.declared)
+        {
+            --links.declared;
+        }
+        links.sources.erase(links.sources.begin() + static_cast<std::ptrdiff_t>(index));
+    }
+
+    void forget_recorded() noexcept
+    {
+        if (m_links == nullptr)
+        {
+            return;
+        }
+        auto& sources = m_links->sources;
+        for (auto i = m_links->declared; i != sources.size(); ++i)
+        {
+            std::erase(sources[i]->m_links->dependents, this);
+        }
+        sources.resize(m_links->declared);
+    }
+
+    [[nodiscard]] std::size_t find_source(const graph_node& source) const noexcept
+    {
+        if (m_links == nullptr)
+        {
+            return none;
+        }
+        const auto& sources = m_links->sources;
+        const auto position = std::find(sources.begin(), sources.end(), &source);
+        return position == sources.end() ? none
+                                         : static_cast<std::size_t>(position - sources.begin());
+    }
+
+    void mark(state new_state) noexcept
+    {
+        if (m_update == nullptr || m_state >= new_state)
+        {
+            return;
+        }
+        m_state = new_state;
+        if (m_links == nullptr)
+        {
+            return;
+        }
+        for (auto* dependent : m_links->dependents)
+        {
+            dependent->mark(state::check);
+        }
+    }
+
+private:
+    struct links
+    {
+        /*
+         * The nodes, which this node is computed from, the declared ones first.
+         */
+        std::vector<graph_node*> sources;
+        std::size_t declared = 0;
+
+        /*
+         * The nodes, which are computed from this node.
+         */
+        std::vector<graph_node*> dependents;
+    };
+
+    /*
+     * The edges of the node, null until the first one.
+     */
+    std::unique_ptr<links> m_links;
+
+    /*
+     * The recompute function, the input nodes do not have it.
+     */
+    update_function m_update;
+
+    /*
+     * Whether the value should be checked or recomputed before the read.
+     */
+    mutable state m_state;
+}; // class graph_node
+
+/**
+ * @internal
+ * @class       derived_storage
+ * @brief       The internal class derived_storage keeps the last computed value, the link to
+ *              the owner, which computes it, and the graph node.
+ *
+ * @tparam TOwner   The owner type.
+ * @tparam T        The value type.
+ * @tparam TCompute The compute function.
+ */
+template <typename TOwner, typename T, auto TCompute>
+class derived_storage : public graph_node
+{
+protected:
+    explicit derived_storage(const TOwner& owner) noexcept
+        : graph_node { &derived_storage::update }
+        , m_owner { this, owner }
+    {
+    }
+
+    /*
+     * The copy is not linked to the sources, it is computed once on the first read.
+     */
+    derived_storage(const derived_storage& other) noexcept
+        : graph_node { other }
+        , m_owner { other.m_owner }
+    {
+    }
+
+    derived_storage& operator=(const derived_storage&) noexcept
+    {
+        graph_node::invalidate();
+        return *this;
+    }
+
+    ~derived_storage() = default;
+
+    [[nodiscard]] const T& value() const
+    {
+        refresh();
+        track();
+        return *m_cache;
+    }
+
+private:
+    static bool update(const graph_node& node)
+    {
+        const auto& self = static_cast<const derived_storage&>(node);
+        T new_value = std::invoke(TCompute, std::as_const(self.m_owner.get(&self)));
+        if constexpr (std::equality_comparable<T>)
+        {
+            if (self.m_cache.has_value() && *self.m_cache == new_value)
+            {
+                return false;
+            }
+        }
+        self.m_cache = std::move(new_value);
+        return true;
+    }
+
+private:
+    /*
+     * The owner, which provides the compute function.
+     */
+    owner_link<TOwner> m_owner;
+
+    /*
+     * The last computed value.
+     */
+    mutable std::optional<T> m_cache;
+}; // class derived_storage
+
+template <typename T>
+concept is_graph_property = std::is_base_of_v<graph_node, T>;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @class          property
+ * @brief          The property specialization which is a source of the derived properties.
+ * @details        The reads (get and the conversion operator) follow the get part of the access
+ *                 policy, the writes (the assignment and the mutable conversion operator) follow
+ *                 the set part and mark the dependent derived properties stale. The reads made
+ *                 by the compute function of a derived property are recorded as its sources.
+ * @example        See the derived property.
+ * @tparam TOwner  is the type of owner, which should have all accesses.
+ * @tparam TValue  is the type of property value.
+ * @tparam TAccessPolicy is the access policy for the property.
+ */
+template <typename TOwner, typename TValue, typename TAccessPolicy>
+class property<TOwner, TValue, TAccessPolicy, input>
+    : private impl::data_storage<TValue>
+    , private impl::graph_node
+{
+    friend TOwner;
+
+    /*
+     * The wrapping storage policies (e.g. cache_aligned) forward to the wrapped property.
+     */
+    template <typename, typename, typename TOtherAccessPolicy, typename TOtherStoragePolicy>
+        requires(impl::is_access_policy<TOtherAccessPolicy>
+                 && impl::is_storage_policy<TOtherStoragePolicy>)
+    friend class property;
+
+    static constexpr bool is_public_get = impl::is_public_get<TAccessPolicy>;
+    static constexpr bool is_public_set = impl::is_public_set<TAccessPolicy>;
+    using storage_type = impl::data_storage<TValue>;
+
+    template <typename TOther>
+    static constexpr bool is_assignable_from =
+        !std::is_same_v<std::remove_cvref_t<TOther>, TValue>
+        && !std::is_same_v<std::remove_cvref_t<TOther>, property>
+        && std::is_assignable_v<TValue&, TOther>;
+
+public:
+    property() noexcept(std::is_nothrow_default_constructible_v<TValue>)
+        requires(std::is_default_constructible_v<TValue>)
+        : storage_type { std::in_place }
+    {
+    }
+
+    property(TValue value) noexcept(std::is_nothrow_move_constructible_v<TValue>)
+        requires(std::is_move_constructible_v<TValue>)
+        : storage_type { std::in_place, std::move(value) }
+    {
+    }
+
+    /**
+     * Constructs the value in place from the given arguments.
+     *
+     * @param args The arguments forwarded to the value constructor.
+     */
+    template <typename... TArgs>
+        requires(std::is_constructible_v<TValue, TArgs...>)
+    explicit property(std::in_place_t, TArgs&&... args)
+        noexcept(std::is_nothrow_constructible_v<TValue, TArgs...>)
+        : storage_type { std::in_place, std::forward<TArgs>(args)... }
+    {
+    }
+
+    ~property() = default;
+
+    property& operator=(const property& other)
+    {
+        this->value() = other.value();
+        graph_node::changed();
+        return *this;
+    }
+
+private:
+    /*
+     * The copy is not linked to the derived properties of the source, only the owner, which
+     * declares its graph again, copies the property.
+     */
+    property(const property&) = default;
+
+public:
+    [[nodiscard]] const TValue& get() const requires(is_public_get)
+    {
+        graph_node::track();
+        return this->value();
+    }
+
+    operator TValue&() requires(is_public_get && is_public_set)
+    {
+        graph_node::changed();
+        return this->value();
+    }
+
+    operator const TValue&() requires(is_public_get && !is_public_set)
+    {
+        graph_node::track();
+        return this->value();
+    }
+
+private:
+    [[nodiscard]] const TValue& get() const requires(!is_public_get)
+    {
+        graph_node::track();
+        return this->value();
+    }
+
+    operator TValue&() requires(!is_public_get)
+    {
+        graph_node::changed();
+        return this->value();
+    }
+
+public:
+    TValue& operator=(const TValue& new_value) requires(is_public_set)
+    {
+        return assign(new_value);
+    }
+
+    TValue& operator=(TValue&& new_value) requires(is_public_set)
+    {
+        return assign(std::move(new_value));
+    }
+
+    template <typename TOther>
+        requires(is_public_set && is_assignable_from<TOther>)
+    TValue& operator=(TOther&& new_value)
+    {
+        return assign(std::forward<TOther>(new_value));
+    }
+
+private:
+    TValue& operator=(const TValue& new_value) requires(!is_public_set)
+    {
+        return assign(new_value);
+    }
+
+    TValue& operator=(TValue&& new_value) requires(!is_public_set)
+    {
+        return assign(std::move(new_value));
+    }
+
+    template <typename TOther>
+        requires(!is_public_set && is_assignable_from<TOther>)
+    TValue& operator=(TOther&& new_value)
+    {
+        return assign(std::forward<TOther>(new_value));
+    }
+
+private:
+    template <typename TOther>
+    TValue& assign(TOther&& new_value)
+    {
+        this->value() = std::forward<TOther>(new_value);
+        graph_node::changed();
+        return this->value();
+    }
+}; // class property<TOwner, TValue, TAccessPolicy, input>
+
+/**
+ * @class          property
+ * @brief          The property specialization which is computed from the other properties.
+ * @details        The sources are the input and the derived properties of the same or other
+ *                 owners, declared by depends_on or read by the last recompute. A write of a
+ *                 source marks only the derived properties reachable from it, which are
+ *                 recomputed lazily on the next read, each once, after its sources. When the
+ *                 recomputed value equals the previous one, its dependents are not recomputed.
+ *                 The reads follow the get part of the access policy, depends_on and invalidate
+ *                 follow the set part.
+ *                 The graph is not synchronized, and the copies are not linked, the copy of the
+ *                 owner should declare the dependencies again. The linked properties unlink
+ *                 themselves on destruction.
+ * @example        struct order
+ *                 {
+ *                     template <class T, class TStoragePolicy = util::input>
+ *                     using property_t = util::property<order, T, util::public_get_set,
+ *                                                       TStoragePolicy>;
+ *                     double compute_total() const { return price.get() * quantity.get(); }
+ *
+ *                     property_t<double> price;
+ *                     property_t<int> quantity;
+ *                     property_t<double, util::derived<&order::compute_total>> total { *this };
+ *
+ *                     order() { total.depends_on(price, quantity); }
+ *                 };
+ * @tparam TOwner  is the type of owner, which should have all accesses.
+ * @tparam TValue  is the type of property value, the result of the compute function.
+ * @tparam TAccessPolicy is the access policy for the property.
+ * @tparam TCompute is the compute function.
+ */
+template <typename TOwner, typename TValue, typename TAccessPolicy, auto TCompute>
+class property<TOwner, TValue, TAccessPolicy, derived<TCompute>>
+    : private impl::derived_storage<TOwner, TValue, TCompute>
+{
+    friend TOwner;
+
+    /*
+     * The wrapping storage policies (e.g. cache_aligned) forward to the wrapped property.
+     */
+    template <typename, typename, typename TOtherAccessPolicy, typename TOtherStoragePolicy>
+        requires(impl::is_access_policy<TOtherAccessPolicy>
+                 && impl::is_storage_policy<TOtherStoragePolicy>)
+    friend class property;
+
+    static constexpr bool is_public_get = impl::is_public_get<TAccessPolicy>;
+    static constexpr bool is_public_set = impl::is_public_set<TAccessPolicy>;
+    using storage_type = impl::derived_storage<TOwner, TValue, TCompute>;
+
+public:
+    explicit property(const TOwner& owner) noexcept
+        : storage_type { owner }
+    {
+    }
+
+    ~property() = default;
+    property& operator=(const property&) = default;
+
+private:
+    /*
+     * The copy keeps the offset to the owner, which is valid only in the copy of the owner, so
+     * only the owner copies the property.
+     */
+    property(const property&) = default;
+
+public:
+    [[nodiscard]] const TValue& get() const requires(is_public_get)
+    {
+        return storage_type::value();
+    }
+
+    operator const TValue&() const requires(is_public_get)
+    {
+        return storage_type::value();
+    }
+
+    [[nodiscard]] bool is_stale() const noexcept requires(is_public_get)
+    {
+        return storage_type::is_stale();
+    }
+
+private:
+    [[nodiscard]] const TValue& get() const requires(!is_public_get)
+    {
+        return storage_type::value();
+    }
+
+    operator const TValue&() const requires(!is_public_get)
+    {
+        return storage_type::value();
+    }
+
+    [[nodiscard]] bool is_stale() const noexcept requires(!is_public_get)
+    {
+        return storage_type::is_stale();
+    }
+
+public:
+    template <typename... TSources>
+        requires(impl::is_graph_property<TSources> && ...)
+    void depends_on(TSources&... sources) requires(is_public_set)
+    {
+        (storage_type::link(static_cast<impl::graph_node&>(sources)), ...);
+    }
+
+    void invalidate() noexcept requires(is_public_set)
+    {
+        storage_type::invalidate();
+    }
+
+private:
+    template <typename... TSources>
+        requires(impl::is_graph_property<TSources> && ...)
+    void depends_on(TSources&... sources) requires(!is_public_set)
+    {
+        (storage_type::link(static_cast<impl::graph_node&>(sources)), ...);
+    }
+
+    void invalidate() noexcept requires(!is_public_set)
+    {
+        storage_type::invalidate();
+    }
+}; // class property<TOwner, TValue, TAccessPolicy, derived<TCompute>>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace util
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // PROPERTY_PROPERTY_GRAPH_H
@@ -0,0 +1,678 @@
+/**
+ * @file        property_history.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of the undo/redo history and the undoable storage
+ *              policy of property class.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef PROPERTY_PROPERTY_HISTORY_H
+#define PROPERTY_PROPERTY_HISTORY_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "property.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace util {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Store the value as an ordinary data member and record every assignment in the history of the
+ * owner.
+ */
+class undoable
+{ };
+
+class history;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <>
+inline constexpr bool enable_storage_policy<undoable> = true;
+
+/**
+ * @internal
+ * @class       delta_arena
+ * @brief       The internal class delta_arena allocates the delta records by bumping the offset
+ *              in the blocks. The allocations are freed only together, by rewinding the arena to
+ *              an earlier allocation, the blocks are kept for reuse.
+ */
+class delta_arena
+{
+    static constexpr std::size_t block_size = 64 * 1024;
+    /*
+     * The records are accessed through memcpy, only the size of the header is kept aligned.
+     */
+    static constexpr std::size_t alignment = alignof(std::uint64_t);
+
+public:
+    /**
+     * The position of an allocation, the arena rewinds to it.
+     */
+    struct mark
+    {
+        std::uint32_t block;
+        std::uint32_t offset;
+    };
+
+    /**
+     * Allocates the bytes, returns them with the mark of the allocation.
+     */
+    std::byte* allocate(std::size_t size, mark& position)
+    {
+        size = (size + alignment - 1) / alignment * alignment;
+        if (m_blocks.empty() || m_blocks[m_block].size - m_offset < size)
+        {
+            next_block(size);
+        }
+        position = { static_cast<std::uint32_t>(m_block), static_cast<std::uint32_t>(m_offset) };
+        m_offset += size;
+        return at(position);
+    }
+
+    [[nodiscard]] std::byte* at(const mark& position) const noexcept
+    {
+        return m_blocks[position.block].data.get() + position.offset;
+    }
+
+    /**
+     * Frees the allocation at the mark and all later ones.
+     */
+    void rewind(const mark& position) noexcept
+    {
+        m_block = position.block;
+        m_offset = position.offset;
+    }
+
+    /**
+     * Frees all allocations and the blocks.
+     */
+    void clear() noexcept
+    {
+        m_blocks.clear();
+        m_block = 0;
+        m_offset = 0;
+    }
+
+    [[nodiscard]] std::size_t capacity() const noexcept
+    {
+        std::size_t result = 0;
+        for (const auto& block : m_blocks)
+        {
+            result += block.size;
+        }
+        return result;
+    }
+
+private:
+    void next_block(std::size_t size)
+    {
+        const std::size_t next = m_blocks.empty() ? 0 : m_block + 1;
+        if (next >= m_blocks.size() || m_blocks[next].size < size)
+        {
+            // The blocks after the current one are free, the too small one is replaced.
+            m_blocks.resize(next);
+            const auto new_size = std::max(size, block_size);
+            m_blocks.push_back({ std::make_unique_for_overwrite<std::byte[]>(new_size),
+                                 new_size });
+        }
+        m_block = next;
+        m_offset = 0;
+    }
+
+private:
+    struct block
+    {
+        std::unique_ptr<std::byte[]> data;
+        std::size_t size;
+    };
+
+    std::vector<block> m_blocks;
+    std::size_t m_block = 0;
+    std::size_t m_offset = 0;
+}; // class delta_arena
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @internal
+ * @class       history_targets
+ * @brief       The internal class history_targets maps the target ids of the delta records to
+ *              the current addresses of the properties.
+ * @details     A property takes an id on its first recorded write, updates the address when it
+ *              is moved and frees the id when it is destroyed. A freed id gets a new generation,
+ *              so the records of the destroyed property are skipped even when the id is reused.
+ *              The table is shared by the history and the handles, so either side may be
+ *              destroyed first.
+ */
+class history_targets
+{
+public:
+    static constexpr std::uint32_t none = std::numeric_limits<std::uint32_t>::max();
+
+    /**
+     * The id and the generation of a target, as stored in the delta record.
+     */
+    struct target_id
+    {
+        std::uint32_t index;
+        std::uint32_t generation;
+    };
+
+    std::uint32_t attach(void* address)
+    {
+        if (m_free == none)
+        {
+            m_targets.push_back({ address, 0, none });
+            return static_cast<std::uint32_t>(m_targets.size() - 1);
+        }
+        const auto index = std::exchange(m_free, m_targets[m_free].next_free);
+        m_targets[index].address = address;
+        return index;
+    }
+
+    void move(std::uint32_t index, void* address) noexcept
+    {
+        m_targets[index].address = address;
+    }
+
+    void detach(std::uint32_t index) noexcept
+    {
+        auto& target = m_targets[index];
+        target.address = nullptr;
+        ++target.generation;
+        target.next_free = std::exchange(m_free, index);
+    }
+
+    [[nodiscard]] target_id id(std::uint32_t index) const noexcept
+    {
+        return { index, m_targets[index].generation };
+    }
+
+    /**
+     * The address of the target, null if it has been destroyed.
+     */
+    [[nodiscard]] void* address(const target_id& id) const noexcept
+    {
+        const auto& target = m_targets[id.index];
+        return target.generation == id.generation ? target.address : nullptr;
+    }
+
+public:
+    /*
+     * The history recording the writes, null after it is destroyed.
+     */
+    history* log = nullptr;
+
+private:
+    struct target
+    {
+        void* address;
+        std::uint32_t generation;
+        std::uint32_t next_free;
+    };
+
+    std::vector<target> m_targets;
+    std::uint32_t m_free = none;
+}; // class history_targets
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @class          history
+ * @brief          The undo/redo log of the property writes of one or many owners.
+ * @details        Every write appends a delta record with the target id of the property and
+ *                 the old and new bytes of the value to the arena, so an edit costs the size of
+ *                 the changed value, not of the owner. The records between two checkpoints form
+ *                 an undo step, undo and redo move the cursor by one step and copy the old or
+ *                 the new bytes of its records back, O(1) per record. A write after undo drops
+ *                 the redo steps and rewinds the arena. The ids follow the properties, when
+ *                 their owners are moved (e.g. by a reallocating vector), and the records of
+ *                 the destroyed properties are skipped. The class is not thread safe.
+ * @example        util::history edits;
+ *                 document doc { util::history_handle { edits } };
+ *                 doc.title = "draft";
+ *                 edits.checkpoint();
+ *                 edits.undo(); // doc.title is restored.
+ */
+class history
+{
+    friend class history_handle;
+
+public:
+    history()
+        : m_targets { std::make_shared<impl::history_targets>() }
+    {
+        m_targets->log = this;
+    }
+
+    history(const history&) = delete;
+    history& operator=(const history&) = delete;
+
+    ~history()
+    {
+        m_targets->log = nullptr;
+    }
+
+    /**
+     * Records the write of the new value over the old one of the target.
+     */
+    template <typename T>
+    void record(impl::history_targets::target_id target, const T& old_value, const T& new_value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "The history records only the trivially copyable values.");
+        drop_redo();
+        impl::delta_arena::mark position {};
+        auto* data = m_arena.allocate(sizeof(delta) + 2 * sizeof(T), position);
+        const delta header { target, sizeof(T) };
+        std::memcpy(data, &header, sizeof(header));
+        std::memcpy(data + sizeof(delta), &old_value, sizeof(T));
+        std::memcpy(data + sizeof(delta) + sizeof(T), &new_value, sizeof(T));
+        m_records.push_back(position);
+    }
+
+    /**
+     * Closes the current undo step, does nothing if it has no records.
+     */
+    void checkpoint()
+    {
+        if (has_open_step())
+        {
+            m_step_ends.push_back(m_records.size());
+            ++m_applied_steps;
+        }
+    }
+
+    /**
+     * Closes the current step and reverts the last applied step.
+     *
+     * @return Whether there was a step to undo.
+     */
+    bool undo()
+    {
+        checkpoint();
+        if (m_applied_steps == 0)
+        {
+            return false;
+        }
+        --m_applied_steps;
+        for (auto i = m_step_ends[m_applied_steps]; i != applied_end(); --i)
+        {
+            apply(m_arena.at(m_records[i - 1]), false);
+        }
+        return true;
+    }
+
+    /**
+     * Applies again the last reverted step.
+     *
+     * @return Whether there was a step to redo.
+     */
+    bool redo() noexcept
+    {
+        if (!can_redo())
+        {
+            return false;
+        }
+        for (auto i = applied_end(); i != m_step_ends[m_applied_steps]; ++i)
+        {
+            apply(m_arena.at(m_records[i]), true);
+        }
+        ++m_applied_steps;
+        return true;
+    }
+
+    [[nodiscard]] bool can_undo() const noexcept
+    {
+        return m_applied_steps != 0 || has_open_step();
+    }
+
+    [[nodiscard]] bool can_redo() const noexcept
+    {
+        return m_applied_steps != m_step_ends.size();
+    }
+
+    /**
+     * The number of the closed steps, including the reverted ones.
+     */
+    [[nodiscard]] std::size_t steps() const noexcept
+    {
+        return m_step_ends.size();
+    }
+
+    /**
+     * The number of the stored delta records.
+     */
+    [[nodiscard]] std::size_t records() const noexcept
+    {
+        return m_records.size();
+    }
+
+    /**
+     * The number of the bytes reserved for the delta records.
+     */
+    [[nodiscard]] std::size_t memory_usage() const noexcept
+    {
+        return m_arena.capacity() + m_records.capacity() * sizeof(impl::delta_arena::mark)
+            + m_step_ends.capacity() * sizeof(std::size_t);
+    }
+
+    /**
+     * Forgets all steps and frees the arena.
+     */
+    void clear() noexcept
+    {
+        m_records.clear();
+        m_records.shrink_to_fit();
+        m_step_ends.clear();
+        m_step_ends.shrink_to_fit();
+        m_applied_steps = 0;
+        m_arena.clear();
+    }
+
+private:
+    /*
+     * The header of a delta record, followed by the old and the new bytes of the value.
+     */
+    struct delta
+    {
+        impl::history_targets::target_id target;
+        std::size_t size;
+    };
+
+    /**
+     * The index of the first record after the applied steps.
+     */
+    [[nodiscard]] std::size_t applied_end() const noexcept
+    {
+        return m_applied_steps == 0 ? 0 : m_step_ends[m_applied_steps - 1];
+    }
+
+    /**
+     * Whether there are records after the last closed step, there are none while the redo
+     * steps exist.
+     */
+    [[nodiscard]] bool has_open_step() const noexcept
+    {
+        return m_applied_steps == m_step_ends.size() && m_records.size() > applied_end();
+    }
+
+    void drop_redo() noexcept
+    {
+        if (!can_redo())
+        {
+            return;
+        }
+        const auto end = applied_end();
+        m_arena.rewind(m_records[end]);
+        m_records.resize(end);
+        m_step_ends.resize(m_applied_steps);
+    }
+
+    void apply(const std::byte* record, bool forward) const noexcept
+    {
+        delta header {};
+        std::memcpy(&header, record, sizeof(header));
+        if (auto* target = m_targets->address(header.target))
+        {
+            const auto* bytes = record + sizeof(delta) + (forward ? header.size : 0);
+            std::memcpy(target, bytes, header.size);
+        }
+    }
+
+private:
+    impl::delta_arena m_arena;
+
+    /*
+     * The addresses of the recorded properties.
+     */
+    std::shared_ptr<impl::history_targets> m_targets;
+
+    /*
+     * The positions of the delta records in the arena.
+     */
+    std::vector<impl::delta_arena::mark> m_records;
+
+    /*
+     * The end record index of every closed step, the first m_applied_steps steps are applied.
+     */
+    std::vector<std::size_t> m_step_ends;
+    std::size_t m_applied_steps = 0;
+}; // class history
+
+/**
+ * @class          history_handle
+ * @brief          The history, which the undoable properties of an owner record to. The default
+ *                 handle is not bound, the writes are not recorded.
+ * @details        The copies of the handle are bound to the same history, the assignment keeps
+ *                 the history of the handle, so the ids of the properties stay in their table.
+ *                 The handle should be declared before the undoable properties of the owner.
+ */
+class history_handle
+{
+    template <typename, typename, typename TAccessPolicy, typename TStoragePolicy>
+        requires(impl::is_access_policy<TAccessPolicy> && impl::is_storage_policy<TStoragePolicy>)
+    friend class property;
+
+public:
+    history_handle() = default;
+
+    explicit history_handle(history& target) noexcept
+        : m_targets { target.m_targets }
+    {
+    }
+
+    history_handle(const history_handle&) = default;
+
+    history_handle& operator=(const history_handle&) noexcept
+    {
+        return *this;
+    }
+
+    [[nodiscard]] bool is_bound() const noexcept
+    {
+        return m_targets != nullptr && m_targets->log != nullptr;
+    }
+
+private:
+    /**
+     * Records the write of the target, assigns the target id on the first one.
+     */
+    template <typename T>
+    void record(std::uint32_t& index, void* target, const T& old_value,
+                const T& new_value) const
+    {
+        if (!is_bound())
+        {
+            return;
+        }
+        if (index == impl::history_targets::none)
+        {
+            index = m_targets->attach(target);
+        }
+        m_targets->log->record(m_targets->id(index), old_value, new_value);
+    }
+
+    void move(std::uint32_t index, void* target) const noexcept
+    {
+        m_targets->move(index, target);
+    }
+
+    void detach(std::uint32_t index) const noexcept
+    {
+        m_targets->detach(index);
+    }
+
+private:
+    std::shared_ptr<impl::history_targets> m_targets;
+}; // class history_handle
+
+/**
+ * @class          property
+ * @brief          The property specialization which records the assignments in the history.
+ * @details        Every assignment records the old and the new value in the history of the
+ *                 handle passed to the constructor. The property refers to the handle by the
+ *                 offset, so the handle should be a member of the same owner, declared before
+ *                 the property. The history reaches the property by its target id, which the
+ *                 move passes to the new property, the copy gets its own one. There is no
+ *                 mutable conversion operator, the writes through a reference could not be
+ *                 recorded. The reads follow the get part of the access policy, the assignments
+ *                 follow the set part.
+ * @example        struct shape
+ *                 {
+ *                     template <class T>
+ *                     using property_t = util::property<shape, T, util::public_get_set,
+ *                                                       util::undoable>;
+ *                     util::history_handle edits;
+ *                     property_t<float> x { edits };
+ *                     property_t<float> y { edits, 1.0f };
+ *                 };
+ * @tparam TOwner  is the type of owner, which should have all accesses.
+ * @tparam TValue  is the type of property value, should be trivially copyable.
+ * @tparam TAccessPolicy is the access policy for the property.
+ */
+template <typename TOwner, typename TValue, typename TAccessPolicy>
+class property<TOwner, TValue, TAccessPolicy, undoable>
+    : private impl::data_storage<TValue>
+{
+    static_assert(std::is_trivially_copyable_v<TValue>,
+                  "The undoable storage policy requires a trivially copyable value type.");
+
+    friend TOwner;
+
+    /*
+     * The wrapping storage policies (e.g. cache_aligned) forward to the wrapped property.
+     */
+    template <typename, typename, typename TOtherAccessPolicy, typename TOtherStoragePolicy>
+        requires(impl::is_access_policy<TOtherAccessPolicy>
+                 && impl::is_storage_policy<TOtherStoragePolicy>)
+    friend class property;
+
+    static constexpr bool is_public_get = impl::is_public_get<TAccessPolicy>;
+    static constexpr bool is_public_set = impl::is_public_set<TAccessPolicy>;
+    using storage_type = impl::data_storage<TValue>;
+
+public:
+    explicit property(const history_handle& handle) noexcept
+        : storage_type { std::in_place }
+        , m_handle { this, handle }
+    {
+    }
+
+    property(const history_handle& handle, TValue value) noexcept
+        : storage_type { std::in_place, value }
+        , m_handle { this, handle }
+    {
+    }
+
+    ~property()
+    {
+        if (m_target != impl::history_targets::none)
+        {
+            m_handle.get(this).detach(m_target);
+        }
+    }
+
+    property& operator=(const property& other)
+    {
+        assign(other.value());
+        return *this;
+    }
+
+private:
+    /*
+     * The copy keeps the offset, which is valid only in the copy of the owner, so only the owner
+     * copies and moves the property.
+     */
+    property(const property& other) noexcept
+        : storage_type { other }
+        , m_handle { other.m_handle }
+    {
+    }
+
+    /*
+     * The move takes the target id, so the history writes the moved value.
+     */
+    property(property&& other) noexcept
+        : storage_type { other }
+        , m_handle { other.m_handle }
+        , m_target { std::exchange(other.m_target, impl::history_targets::none) }
+    {
+        if (m_target != impl::history_targets::none)
+        {
+            m_handle.get(this).move(m_target, &this->value());
+        }
+    }
+
+public:
+    [[nodiscard]] const TValue& get() const noexcept requires(is_public_get)
+    {
+        return this->value();
+    }
+
+    operator const TValue&() const noexcept requires(is_public_get)
+    {
+        return this->value();
+    }
+
+private:
+    [[nodiscard]] const TValue& get() const noexcept requires(!is_public_get)
+    {
+        return this->value();
+    }
+
+    operator const TValue&() const noexcept requires(!is_public_get)
+    {
+        return this->value();
+    }
+
+public:
+    const TValue& operator=(const TValue& new_value) requires(is_public_set)
+    {
+        return assign(new_value);
+    }
+
+private:
+    const TValue& operator=(const TValue& new_value) requires(!is_public_set)
+    {
+        return assign(new_value);
+    }
+
+private:
+    const TValue& assign(const TValue& new_value)
+    {
+        m_handle.get(this).record(m_target, &this->value(), this->value(), new_value);
+        return this->value() = new_value;
+    }
+
+private:
+    /*
+     * The history handle of the owner.
+     */
+    impl::owner_link<const history_handle> m_handle;
+
+    /*
+     * The id of the property in the history, none before the first recorded write.
+     */
+    std::uint32_t m_target = impl::history_targets::none;
+}; // class property<TOwner, TValue, TAccessPolicy, undoable>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace util
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // PROPERTY_PROPERTY_HISTORY_H
@@ -0,0 +1,678 @@
+/**
+ * @file        property_journal.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of the write-ahead journal of property writes and
+ *              the journaled storage policy of property class. Requires POSIX.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef PROPERTY_PROPERTY_JOURNAL_H
+#define PROPERTY_PROPERTY_JOURNAL_H
+
+#if defined(_WIN32)
+#error "property_journal.h requires POSIX file descriptors."
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "property.h"
+#include "property_reflection.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace util {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Store the value as an ordinary data member and append every assignment to the journal of the
+ * owner.
+ *
+ * @tparam TIndex The index of the property in the journal records of the owner.
+ */
+template <std::uint32_t TIndex>
+class journaled
+{ };
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <std::uint32_t TIndex>
+inline constexpr bool enable_storage_policy<journaled<TIndex>> = true;
+
+template <typename TStoragePolicy>
+inline constexpr bool is_journaled = false;
+
+template <std::uint32_t TIndex>
+inline constexpr bool is_journaled<journaled<TIndex>> = true;
+
+/**
+ * @internal
+ * @brief       The header of a journal record, followed by the value bytes.
+ */
+struct journal_record_header
+{
+    std::uint32_t checksum;
+    std::uint32_t size;
+    std::uint32_t property_index;
+    std::uint32_t reserved;
+    std::uint64_t owner_id;
+};
+
+/**
+ * @internal
+ * @brief       The 32-bit FNV-1a hash of the record, which detects the torn tail of the file.
+ */
+inline std::uint32_t journal_checksum(const journal_record_header& header,
+                                      std::span<const std::byte> value) noexcept
+{
+    std::uint32_t hash = 2166136261u;
+    const auto mix = [&](std::span<const std::byte> bytes)
+    {
+        for (const auto byte : bytes)
+        {
+            hash = (hash ^ static_cast<std::uint32_t>(byte)) * 16777619u;
+        }
+    };
+    mix(std::as_bytes(std::span { &header.size, 1 }));
+    mix(std::as_bytes(std::span { &header.property_index, 1 }));
+    mix(std::as_bytes(std::span { &header.reserved, 1 }));
+    mix(std::as_bytes(std::span { &header.owner_id, 1 }));
+    mix(value);
+    return hash;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @class          journal
+ * @brief          The append-only file of the property writes with group commit.
+ * @details        The writers copy the records into the in-memory ring buffer and return. The
+ *                 background thread writes the accumulated records to the file and syncs them
+ *                 with one fdatasync per batch, so the concurrent writers share the syncs. The
+ *                 writers wait only when the ring buffer is full. flush waits until all
+ *                 records appended before it are durable. A record is the checksum, the owner
+ *                 id, the property index and the value bytes; replay reads the records back and
+ *                 stops at the torn or corrupted tail, which the constructor truncates.
+ *                 The errors are reported by std::system_error.
+ * @example        util::journal file { "state.journal" };
+ *                 account a { util::journal_handle { file, 1 } };
+ *                 a.balance = 100; // Appends the record.
+ *                 file.flush();
+ */
+class journal
+{
+public:
+    /**
+     * Opens the journal file for appending, creates it if it does not exist. The torn or
+     * corrupted tail of the existing file is truncated.
+     *
+     * @param path     The path of the file.
+     * @param capacity The size of the ring buffer in bytes.
+     */
+    explicit journal(const std::filesystem::path& path, std::size_t capacity = 1 << 20)
+        : m_descriptor { ::open(path.c_str(), O_RDWR | O_APPEND | O_CREAT | O_CLOEXEC, 0644) }
+        , m_ring(capacity)
+    {
+        if (m_descriptor < 0)
+        {
+            throw std::system_error { errno, std::generic_category(), "util::journal: open" };
+        }
+        try
+        {
+            truncate_invalid_tail();
+        }
+        catch (...)
+        {
+            ::close(m_descriptor);
+            throw;
+        }
+        m_flusher = std::thread { [this] { run(); } };
+    }
+
+    journal(const journal&) = delete;
+    journal& operator=(const journal&) = delete;
+
+    /**
+     * Writes and syncs the remaining records.
+     */
+    ~journal()
+    {
+        {
+            std::lock_guard lock { m_mutex };
+            m_stopping = true;
+        }
+        m_wake_flusher.notify_one();
+        m_flusher.join();
+        ::close(m_descriptor);
+    }
+
+    /**
+     * Appends the record to the ring buffer, waits if the buffer is full.
+     *
+     * @throw std::length_error if the record is larger than the ring buffer, std::system_error
+     *        if the journal has failed to write.
+     */
+    void append(std::uint64_t owner_id, std::uint32_t property_index,
+                std::span<const std::byte> value)
+    {
+        impl::journal_record_header header {
+            0, static_cast<std::uint32_t>(value.size()), property_index, 0, owner_id };
+        header.checksum = impl::journal_checksum(header, value);
+        const auto record_size = sizeof(header) + value.size();
+        if (record_size > m_ring.size())
+        {
+            throw std::length_error { "util::journal: the record is larger than the buffer" };
+        }
+
+        std::unique_lock lock { m_mutex };
+        m_wake_writers.wait(lock, [&]
+        {
+            return m_error != 0 || m_ring.size() - (m_appended - m_written) >= record_size;
+        });
+        throw_if_failed();
+        copy_to_ring(std::as_bytes(std::span { &header, 1 }));
+        copy_to_ring(value);
+        lock.unlock();
+        m_wake_flusher.notify_one();
+    }
+
+    /**
+     * Waits until all records appended before the call are written and synced.
+     */
+    void flush()
+    {
+        std::unique_lock lock { m_mutex };
+        const auto target = m_appended;
+        m_wake_writers.wait(lock, [&] { return m_error != 0 || m_durable >= target; });
+        throw_if_failed();
+    }
+
+    /**
+     * Reads the records of the journal file in the order of appending.
+     *
+     * @param path     The path of the file.
+     * @param function The function, which takes the owner id, the property index and the value
+     *                 bytes.
+     * @return The number of the valid records, the torn or corrupted tail is ignored.
+     */
+    template <typename TFunction>
+    static std::size_t replay(const std::filesystem::path& path, TFunction&& function)
+    {
+        const int descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (descriptor < 0)
+        {
+            throw std::system_error { errno, std::generic_category(), "util::journal: open" };
+        }
+        try
+        {
+            const auto records = scan(descriptor, function).first;
+            ::close(descriptor);
+            return records;
+        }
+        catch (...)
+        {
+            ::close(descriptor);
+            throw;
+        }
+    }
+
+private:
+    /**
+     * Reads the records from the descriptor in chunks and passes them to the function.
+     *
+     * @return The number of the valid records and the length of the file they take.
+     */
+    template <typename TFunction>
+    static std::pair<std::size_t, std::uint64_t> scan(int descriptor, TFunction& function)
+    {
+        struct stat status {};
+        if (::fstat(descriptor, &status) != 0)
+        {
+            throw std::system_error { errno, std::generic_category(), "util::journal: fstat" };
+        }
+        const auto file_size = static_cast<std::uint64_t>(status.st_size);
+
+        std::vector<std::byte> buffer(std::size_t { 1 } << 16);
+        std::size_t begin = 0;
+        std::size_t end = 0;
+        std::uint64_t offset = 0;
+        std::size_t records = 0;
+        for (bool at_end = false;;)
+        {
+            impl::journal_record_header header {};
+            const auto available = end - begin;
+            if (available >= sizeof(header))
+            {
+                std::memcpy(&header, buffer.data() + begin, sizeof(header));
+                const auto record_size = sizeof(header) + std::size_t { header.size };
+                if (offset + record_size > file_size)
+                {
+                    break;
+                }
+                if (available >= record_size)
+                {
+                    const std::span<const std::byte> value {
+                        buffer.data() + begin + sizeof(header), header.size };
+                    if (header.checksum != impl::journal_checksum(header, value))
+                    {
+                        break;
+                    }
+                    function(header.owner_id, header.property_index, value);
+                    begin += record_size;
+                    offset += record_size;
+                    ++records;
+                    continue;
+                }
+                // The size is bounded by the file size, the corrupted ones are rejected above.
+                buffer.resize(std::max(buffer.size(), record_size));
+            }
+            if (at_end)
+            {
+                break;
+            }
+            std::memmove(buffer.data(), buffer.data() + begin, available);
+            begin = 0;
+            end = available;
+            const auto count = read_some(descriptor, buffer.data() + end, buffer.size() - end);
+            at_end = count == 0;
+            end += count;
+        }
+        return { records, offset };
+    }
+
+    static std::size_t read_some(int descriptor, std::byte* data, std::size_t size)
+    {
+        for (;;)
+        {
+            const auto count = ::read(descriptor, data, size);
+            if (count >= 0)
+            {
+                return static_cast<std::size_t>(count);
+            }
+            if (errno != EINTR)
+            {
+                throw std::system_error { errno, std::generic_category(), "util::journal: read" };
+            }
+        }
+    }
+
+    /**
+     * Cuts the torn or corrupted tail left by a crash, so the new records follow the last
+     * valid one and stay reachable by replay.
+     */
+    void truncate_invalid_tail()
+    {
+        const auto ignore = [](std::uint64_t, std::uint32_t, std::span<const std::byte>) { };
+        const auto valid_length = scan(m_descriptor, ignore).second;
+        struct stat status {};
+        if (::fstat(m_descriptor, &status) != 0)
+        {
+            throw std::system_error { errno, std::generic_category(), "util::journal: fstat" };
+        }
+        if (static_cast<std::uint64_t>(status.st_size) == valid_length)
+        {
+            return;
+        }
+        if (::ftruncate(m_descriptor, static_cast<off_t>(valid_length)) != 0)
+        {
+            throw std::system_error { errno, std::generic_category(),
+                                      "util::journal: ftruncate" };
+        }
+        if (const int error = sync(); error != 0)
+        {
+            throw std::system_error { error, std::generic_category(), "util::journal: sync" };
+        }
+    }
+
+    void copy_to_ring(std::span<const std::byte> bytes) noexcept
+    {
+        const auto offset = static_cast<std::size_t>(m_appended % m_ring.size());
+        const auto first = std::min(bytes.size(), m_ring.size() - offset);
+        std::memcpy(m_ring.data() + offset, bytes.data(), first);
+        std::memcpy(m_ring.data(), bytes.data() + first, bytes.size() - first);
+        m_appended += bytes.size();
+    }
+
+    void throw_if_failed() const
+    {
+        if (m_error != 0)
+        {
+            throw std::system_error { m_error, std::generic_category(), "util::journal: write" };
+        }
+    }
+
+    /**
+     * Writes the bytes to the file, returns the error code.
+     */
+    int write_all(const std::byte* data, std::size_t size) noexcept
+    {
+        while (size != 0)
+        {
+            const auto count = ::write(m_descriptor, data, size);
+            if (count < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                return errno;
+            }
+            data += count;
+            size -= static_cast<std::size_t>(count);
+        }
+        return 0;
+    }
+
+    int sync() noexcept
+    {
+#if defined(__APPLE__)
+        return ::fsync(m_descriptor) == 0 ? 0 : errno;
+#else
+        return ::fdatasync(m_descriptor) == 0 ? 0 : errno;
+#endif
+    }
+
+    /**
+     * The loop of the background thread, each iteration writes and syncs all records appended
+     * since the previous one.
+     */
+    void run()
+    {
+        std::unique_lock lock { m_mutex };
+        for (;;)
+        {
+            m_wake_flusher.wait(lock, [&] { return m_stopping || m_appended != m_written; });
+            if (m_appended == m_written || m_error != 0)
+            {
+                if (m_stopping)
+                {
+                    return;
+                }
+                m_written = m_appended;
+                continue;
+            }
+            const auto begin = m_written;
+            const auto end = m_appended;
+            lock.unlock();
+
+            // The writers do not touch the range until m_written passes it.
+            const auto offset = static_cast<std::size_t>(begin % m_ring.size());
+            const auto size = static_cast<std::size_t>(end - begin);
+            const auto first = std::min(size, m_ring.size() - offset);
+            int error = write_all(m_ring.data() + offset, first);
+            if (error == 0)
+            {
+                error = write_all(m_ring.data(), size - first);
+            }
+            if (error == 0)
+            {
+                error = sync();
+            }
+
+            lock.lock();
+            m_written = end;
+            if (error == 0)
+            {
+                m_durable = end;
+            }
+            else
+            {
+                m_error = error;
+            }
+            m_wake_writers.notify_all();
+        }
+    }
+
+private:
+    /*
+     * The journal file, opened for appending.
+     */
+    int m_descriptor;
+
+    /*
+     * The records not yet written to the file, the byte i of the stream is at i % size.
+     */
+    std::vector<std::byte> m_ring;
+
+    /*
+     * The positions in the stream of the journal bytes: appended to the ring buffer, written to
+     * the file, and synced.
+     */
+    std::uint64_t m_appended = 0;
+    std::uint64_t m_written = 0;
+    std::uint64_t m_durable = 0;
+
+    /*
+     * The errno of the failed write or sync, the journal does not accept records after it.
+     */
+    int m_error = 0;
+    bool m_stopping = false;
+
+    std::mutex m_mutex;
+    std::condition_variable m_wake_flusher;
+    std::condition_variable m_wake_writers;
+    std::thread m_flusher;
+}; // class journal
+
+/**
+ * @class          journal_handle
+ * @brief          The journal and the id of an owner, which the journaled properties of the
+ *                 owner write to. The default handle is not bound, the writes are not journaled.
+ */
+class journal_handle
+{
+public:
+    journal_handle() = default;
+
+    journal_handle(journal& target, std::uint64_t owner_id) noexcept
+        : m_journal { &target }
+        , m_owner_id { owner_id }
+    {
+    }
+
+    [[nodiscard]] bool is_bound() const noexcept
+    {
+        return m_journal != nullptr;
+    }
+
+    [[nodiscard]] std::uint64_t owner_id() const noexcept
+    {
+        return m_owner_id;
+    }
+
+    void append(std::uint32_t property_index, std::span<const std::byte> value) const
+    {
+        if (m_journal != nullptr)
+        {
+            m_journal->append(m_owner_id, property_index, value);
+        }
+    }
+
+private:
+    journal* m_journal = nullptr;
+    std::uint64_t m_owner_id = 0;
+}; // class journal_handle
+
+/**
+ * @class          property
+ * @brief          The property specialization which journals the assignments.
+ * @details        Every assignment appends the new value to the journal of the handle passed
+ *                 to the constructor, before changing the value. The property refers to the
+ *                 handle by the offset, so the handle should be a member of the same owner.
+ *                 There is no mutable conversion operator, the writes through a reference
+ *                 could not be journaled. The reads (get and the conversion operator) follow
+ *                 the get part of the access policy, the assignments follow the set part.
+ * @example        struct account
+ *                 {
+ *                     template <class T, std::uint32_t I>
+ *                     using property_t = util::property<account, T, util::public_get_set,
+ *                                                       util::journaled<I>>;
+ *                     util::journal_handle log;
+ *                     property_t<long, 0> balance { log };
+ *                     property_t<int, 1> limit { log, 500 };
+ *                 };
+ * @tparam TOwner  is the type of owner, which should have all accesses.
+ * @tparam TValue  is the type of property value, should be trivially copyable.
+ * @tparam TAccessPolicy is the access policy for the property.
+ * @tparam TIndex  is the index of the property in the journal records.
+ */
+template <typename TOwner, typename TValue, typename TAccessPolicy, std::uint32_t TIndex>
+class property<TOwner, TValue, TAccessPolicy, journaled<TIndex>>
+    : private impl::data_storage<TValue>
+{
+    static_assert(std::is_trivially_copyable_v<TValue>,
+                  "The journaled storage policy requires a trivially copyable value type.");
+
+    friend TOwner;
+    friend impl::property_access;
+
+    /*
+     * The wrapping storage policies (e.g. cache_aligned) forward to the wrapped property.
+     */
+    template <typename, typename, typename TOtherAccessPolicy, typename TOtherStoragePolicy>
+        requires(impl::is_access_policy<TOtherAccessPolicy>
+                 && impl::is_storage_policy<TOtherStoragePolicy>)
+    friend class property;
+
+    static constexpr bool is_public_get = impl::is_public_get<TAccessPolicy>;
+    static constexpr bool is_public_set = impl::is_public_set<TAccessPolicy>;
+    using storage_type = impl::data_storage<TValue>;
+
+public:
+    /*
+     * The index of the property in the journal records.
+     */
+    static constexpr std::uint32_t index = TIndex;
+
+    explicit property(const journal_handle& handle) noexcept
+        : storage_type { std::in_place }
+        , m_handle { this, handle }
+    {
+    }
+
+    property(const journal_handle& handle, TValue value) noexcept
+        : storage_type { std::in_place, value }
+        , m_handle { this, handle }
+    {
+    }
+
+    ~property() = default;
+
+    property& operator=(const property& other)
+    {
+        assign(other.value());
+        return *this;
+    }
+
+private:
+    /*
+     * The copy keeps the offset, which is valid only in the copy of the owner, so only the owner
+     * copies the property.
+     */
+    property(const property&) = default;
+
+public:
+    [[nodiscard]] const TValue& get() const noexcept requires(is_public_get)
+    {
+        return this->value();
+    }
+
+    operator const TValue&() const noexcept requires(is_public_get)
+    {
+        return this->value();
+    }
+
+private:
+    [[nodiscard]] const TValue& get() const noexcept requires(!is_public_get)
+    {
+        return this->value();
+    }
+
+    operator const TValue&() const noexcept requires(!is_public_get)
+    {
+        return this->value();
+    }
+
+public:
+    const TValue& operator=(const TValue& new_value) requires(is_public_set)
+    {
+        return assign(new_value);
+    }
+
+private:
+    const TValue& operator=(const TValue& new_value) requires(!is_public_set)
+    {
+        return assign(new_value);
+    }
+
+private:
+    const TValue& assign(const TValue& new_value)
+    {
+        m_handle.get(this).append(TIndex, std::as_bytes(std::span { &new_value, 1 }));
+        return this->value() = new_value;
+    }
+
+private:
+    /*
+     * The journal handle of the owner.
+     */
+    impl::owner_link<const journal_handle> m_handle;
+}; // class property<TOwner, TValue, TAccessPolicy, journaled<TIndex>>
+
+/**
+ * Applies the replayed record to the journaled property of the owner with the given index,
+ * without journaling it again.
+ *
+ * @param owner          The owner, it should list its journaled properties.
+ * @param property_index The property index of the record.
+ * @param value          The value bytes of the record.
+ * @return Whether the owner has the journaled property with the index and the value size.
+ */
+template <reflectable TOwner>
+bool apply_journal_record(TOwner& owner, std::uint32_t property_index,
+                          std::span<const std::byte> value) noexcept
+{
+    bool applied = false;
+    for_each_member<TOwner>([&]<typename TMember>(TMember)
+    {
+        using value_type = typename TMember::value_type;
+        if constexpr (impl::is_journaled<typename TMember::storage_policy>)
+        {
+            if (!applied && property_index == TMember::property_type::index
+                && value.size() == sizeof(value_type))
+            {
+                auto& target = impl::property_access::value(owner.*TMember::pointer);
+                std::memcpy(&target, value.data(), sizeof(value_type));
+                applied = true;
+            }
+        }
+    });
+    return applied;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace util
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // PROPERTY_PROPERTY_JOURNAL_H
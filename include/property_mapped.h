@@ -0,0 +1,488 @@
+/**
+ * @file        property_mapped.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of the memory-mapped file arena of owners.
+ *              Requires POSIX mmap.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef PROPERTY_PROPERTY_MAPPED_H
+#define PROPERTY_PROPERTY_MAPPED_H
+
+#if defined(_WIN32)
+#error "property_mapped.h requires POSIX mmap."
+#endif
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <new>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "property.h"
+#include "property_reflection.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace util {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * The version of the owner layout, which is stored in the layout hash of the mapped files. By
+ * default it is TOwner::layout_version, or 0 if there is none. Bumping it rejects the files of
+ * the earlier versions, e.g. when the meaning of a member changes, but the layout does not.
+ *
+ * @example        struct account
+ *                 {
+ *                     static constexpr std::uint64_t layout_version = 2;
+ *                     util::property<account, long, util::public_get_set> balance;
+ *                 };
+ */
+template <typename TOwner>
+inline constexpr std::uint64_t layout_version = 0;
+
+template <typename TOwner>
+    requires requires { TOwner::layout_version; }
+inline constexpr std::uint64_t layout_version<TOwner> = TOwner::layout_version;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @internal
+ * @brief       The 64-bit FNV-1a hash, which can be continued from the previous result.
+ */
+constexpr std::uint64_t fnv1a(std::string_view text,
+                              std::uint64_t hash = 14695981039346656037ull) noexcept
+{
+    for (const char symbol : text)
+    {
+        hash = (hash ^ static_cast<unsigned char>(symbol)) * 1099511628211ull;
+    }
+    return hash;
+}
+
+constexpr std::uint64_t fnv1a(std::uint64_t value, std::uint64_t hash) noexcept
+{
+    for (int i = 0; i < 8; ++i, value >>= 8)
+    {
+        hash = (hash ^ (value & 0xff)) * 1099511628211ull;
+    }
+    return hash;
+}
+
+/**
+ * @internal
+ * @brief       The offset of the member in the owner, measured on a zeroed owner, which is
+ *              created by bit_cast, so the owner needs no default constructor.
+ */
+template <typename TOwner, auto TPointer>
+std::uint64_t member_offset() noexcept
+{
+    const auto owner = std::bit_cast<TOwner>(std::array<std::byte, sizeof(TOwner)> {});
+    return static_cast<std::uint64_t>(reinterpret_cast<const std::byte*>(&(owner.*TPointer))
+                                      - reinterpret_cast<const std::byte*>(&owner));
+}
+
+/**
+ * @internal
+ * @brief       The hash of the owner layout: the layout version, the size, the alignment and
+ *              the traits of the owner, and the names, offsets, sizes, alignments and traits of
+ *              the listed properties. Only the facts fixed by the ABI are hashed, not the type
+ *              names, so the hash does not depend on the compiler.
+ */
+template <typename TOwner>
+std::uint64_t layout_hash() noexcept
+{
+    const auto traits = [](auto type) -> std::uint64_t
+    {
+        using value_type = typename decltype(type)::type;
+        return std::uint64_t { std::is_trivially_copyable_v<value_type> }
+            | (std::uint64_t { std::has_unique_object_representations_v<value_type> } << 1)
+            | (std::uint64_t { std::is_floating_point_v<value_type> } << 2)
+            | (std::uint64_t { std::is_signed_v<value_type> } << 3);
+    };
+    auto hash = fnv1a(layout_version<TOwner>, fnv1a("util::mapped_arena"));
+    hash = fnv1a(alignof(TOwner), fnv1a(sizeof(TOwner), hash));
+    hash = fnv1a(traits(std::type_identity<TOwner> {}), hash);
+    if constexpr (reflectable<TOwner>)
+    {
+        util::for_each_member<TOwner>([&](auto member)
+        {
+            using member_type = decltype(member);
+            using value_type = typename member_type::value_type;
+            hash = fnv1a(member_type::name, hash);
+            hash = fnv1a(member_offset<TOwner, member_type::pointer>(), hash);
+            hash = fnv1a(sizeof(value_type), hash);
+            hash = fnv1a(alignof(value_type), hash);
+            hash = fnv1a(traits(std::type_identity<value_type> {}), hash);
+        });
+    }
+    return hash;
+}
+
+/**
+ * @internal
+ * @brief       The header at the beginning of the arena file.
+ */
+struct mapped_header
+{
+    std::uint64_t magic;
+    std::uint64_t layout_hash;
+    std::uint64_t owner_size;
+    std::uint64_t capacity;
+    std::uint64_t size;
+};
+
+[[noreturn]] inline void throw_errno(const char* what)
+{
+    throw std::system_error { errno, std::generic_category(), what };
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @class          mapped_arena
+ * @brief          The growable array of owners, which lives directly in a memory-mapped file.
+ * @details        The writes to the owners, e.g. through the property assignments, go straight
+ *                 to the shared mapping, so reopening the file restores the owners without
+ *                 parsing. flush makes the writes durable. The file starts with a header with
+ *                 the magic number and the layout hash of the owner, the files of the other
+ *                 layouts are rejected. The owners should be trivially copyable and should not
+ *                 contain pointers, the listed properties participate in the layout hash, and
+ *                 util::layout_version marks the incompatible versions of the same layout.
+ *                 The growth remaps the file, which invalidates the references to the owners.
+ *                 The moved from arena is empty and has no file, it can be read, flushed,
+ *                 assigned to and destroyed, but not grown. The errors are reported by
+ *                 std::system_error.
+ * @example        util::mapped_arena<account> accounts { "accounts.bin" };
+ *                 if (accounts.empty()) { accounts.emplace_back(); }
+ *                 accounts[0].balance = 100;
+ *                 accounts.flush();
+ * @tparam TOwner  is the type of owner.
+ */
+template <typename TOwner>
+class mapped_arena
+{
+    static_assert(std::is_trivially_copyable_v<TOwner>,
+                  "The mapped arena requires a trivially copyable owner.");
+
+    static constexpr std::uint64_t magic = 0x504f5250'4d415031ull; // "PORPMAP1"
+    static constexpr std::size_t header_size =
+        (sizeof(impl::mapped_header) + alignof(TOwner) - 1) / alignof(TOwner) * alignof(TOwner);
+
+public:
+    /**
+     * Opens the arena file, or creates it if it does not exist or is empty.
+     *
+     * @param path     The path of the file.
+     * @param capacity The minimum number of owners to reserve space for.
+     * @throw std::system_error if the file can not be opened or mapped, or it has a different
+     *                          layout (std::errc::invalid_argument).
+     */
+    explicit mapped_arena(const std::filesystem::path& path, std::size_t capacity = 64)
+        : m_descriptor { ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644) }
+    {
+        if (m_descriptor < 0)
+        {
+            impl::throw_errno("util::mapped_arena: open");
+        }
+        try
+        {
+            open(std::max<std::size_t>(capacity, 1));
+        }
+        catch (...)
+        {
+            close();
+            throw;
+        }
+    }
+
+    mapped_arena(mapped_arena&& other) noexcept
+        : m_descriptor { std::exchange(other.m_descriptor, -1) }
+        , m_mapping { std::exchange(other.m_mapping, nullptr) }
+        , m_mapping_size { std::exchange(other.m_mapping_size, 0) }
+    {
+    }
+
+    mapped_arena& operator=(mapped_arena&& other) noexcept
+    {
+        if (this != &other)
+        {
+            close();
+            m_descriptor = std::exchange(other.m_descriptor, -1);
+            m_mapping = std::exchange(other.m_mapping, nullptr);
+            m_mapping_size = std::exchange(other.m_mapping_size, 0);
+        }
+        return *this;
+    }
+
+    ~mapped_arena()
+    {
+        close();
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return m_mapping != nullptr ? static_cast<std::size_t>(header().size) : 0;
+    }
+
+    [[nodiscard]] std::size_t capacity() const noexcept
+    {
+        return m_mapping != nullptr ? static_cast<std::size_t>(header().capacity) : 0;
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    /**
+     * The owners, null for the moved from arena.
+     */
+    [[nodiscard]] TOwner* data() noexcept
+    {
+        if (m_mapping == nullptr)
+        {
+            return nullptr;
+        }
+        return std::launder(reinterpret_cast<TOwner*>(m_mapping + header_size));
+    }
+
+    [[nodiscard]] const TOwner* data() const noexcept
+    {
+        if (m_mapping == nullptr)
+        {
+            return nullptr;
+        }
+        return std::launder(reinterpret_cast<const TOwner*>(m_mapping + header_size));
+    }
+
+    [[nodiscard]] TOwner& operator[](std::size_t index) noexcept
+    {
+        return data()[index];
+    }
+
+    [[nodiscard]] const TOwner& operator[](std::size_t index) const noexcept
+    {
+        return data()[index];
+    }
+
+    [[nodiscard]] TOwner* begin() noexcept
+    {
+        return data();
+    }
+
+    [[nodiscard]] TOwner* end() noexcept
+    {
+        return data() + size();
+    }
+
+    [[nodiscard]] const TOwner* begin() const noexcept
+    {
+        return data();
+    }
+
+    [[nodiscard]] const TOwner* end() const noexcept
+    {
+        return data() + size();
+    }
+
+    /**
+     * Constructs the owner at the end of the arena, the file grows twice if it is full.
+     */
+    template <typename... TArgs>
+    TOwner& emplace_back(TArgs&&... args)
+    {
+        if (size() == capacity())
+        {
+            reserve(2 * capacity());
+        }
+        auto* owner = ::new (static_cast<void*>(data() + size()))
+            TOwner(std::forward<TArgs>(args)...);
+        ++header().size;
+        return *owner;
+    }
+
+    void pop_back() noexcept
+    {
+        --header().size;
+    }
+
+    void clear() noexcept
+    {
+        header().size = 0;
+    }
+
+    /**
+     * Grows the file, so it fits at least the given number of owners.
+     */
+    void reserve(std::size_t new_capacity)
+    {
+        if (new_capacity <= capacity())
+        {
+            return;
+        }
+        const auto new_mapping_size = mapping_size_for(new_capacity);
+        if (::ftruncate(m_descriptor, static_cast<off_t>(new_mapping_size)) != 0)
+        {
+            impl::throw_errno("util::mapped_arena: ftruncate");
+        }
+        // The new mapping is created before the old one is released, so a failure keeps the arena.
+        auto* new_mapping = map(new_mapping_size);
+        unmap();
+        m_mapping = new_mapping;
+        m_mapping_size = new_mapping_size;
+        header().capacity = new_capacity;
+    }
+
+    /**
+     * Writes the changes to the file and waits for the completion.
+     */
+    void flush()
+    {
+        if (m_mapping != nullptr && ::msync(m_mapping, m_mapping_size, MS_SYNC) != 0)
+        {
+            impl::throw_errno("util::mapped_arena: msync");
+        }
+    }
+
+    /**
+     * Schedules the write of the changes to the file.
+     */
+    void flush_async()
+    {
+        if (m_mapping != nullptr && ::msync(m_mapping, m_mapping_size, MS_ASYNC) != 0)
+        {
+            impl::throw_errno("util::mapped_arena: msync");
+        }
+    }
+
+private:
+    [[nodiscard]] impl::mapped_header& header() noexcept
+    {
+        return *std::launder(reinterpret_cast<impl::mapped_header*>(m_mapping));
+    }
+
+    [[nodiscard]] const impl::mapped_header& header() const noexcept
+    {
+        return *std::launder(reinterpret_cast<const impl::mapped_header*>(m_mapping));
+    }
+
+    static std::size_t mapping_size_for(std::size_t capacity) noexcept
+    {
+        return header_size + capacity * sizeof(TOwner);
+    }
+
+    void open(std::size_t capacity)
+    {
+        struct stat status {};
+        if (::fstat(m_descriptor, &status) != 0)
+        {
+            impl::throw_errno("util::mapped_arena: fstat");
+        }
+        const auto file_size = static_cast<std::size_t>(status.st_size);
+        if (file_size == 0)
+        {
+            if (::ftruncate(m_descriptor, static_cast<off_t>(mapping_size_for(capacity))) != 0)
+            {
+                impl::throw_errno("util::mapped_arena: ftruncate");
+            }
+            m_mapping = map(mapping_size_for(capacity));
+            m_mapping_size = mapping_size_for(capacity);
+            ::new (static_cast<void*>(m_mapping)) impl::mapped_header {
+                magic, impl::layout_hash<TOwner>(), sizeof(TOwner), capacity, 0 };
+            return;
+        }
+
+        if (file_size < header_size)
+        {
+            throw_invalid("util::mapped_arena: the file is too short");
+        }
+        m_mapping = map(file_size);
+        m_mapping_size = file_size;
+        const auto& stored = header();
+        if (stored.magic != magic)
+        {
+            throw_invalid("util::mapped_arena: the file is not an arena");
+        }
+        if (stored.layout_hash != impl::layout_hash<TOwner>()
+            || stored.owner_size != sizeof(TOwner))
+        {
+            throw_invalid("util::mapped_arena: the file has a different owner layout");
+        }
+        if (stored.size > stored.capacity || mapping_size_for(stored.capacity) > file_size)
+        {
+            throw_invalid("util::mapped_arena: the file is truncated");
+        }
+        reserve(capacity);
+    }
+
+    [[nodiscard]] std::byte* map(std::size_t size) const
+    {
+        void* mapping = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, m_descriptor, 0);
+        if (mapping == MAP_FAILED)
+        {
+            impl::throw_errno("util::mapped_arena: mmap");
+        }
+        return static_cast<std::byte*>(mapping);
+    }
+
+    void unmap() noexcept
+    {
+        if (m_mapping != nullptr)
+        {
+            ::munmap(m_mapping, m_mapping_size);
+            m_mapping = nullptr;
+            m_mapping_size = 0;
+        }
+    }
+
+    void close() noexcept
+    {
+        unmap();
+        if (m_descriptor >= 0)
+        {
+            ::close(m_descriptor);
+            m_descriptor = -1;
+        }
+    }
+
+    [[noreturn]] static void throw_invalid(const char* what)
+    {
+        throw std::system_error { std::make_error_code(std::errc::invalid_argument), what };
+    }
+
+private:
+    /*
+     * The descriptor of the arena file.
+     */
+    int m_descriptor = -1;
+
+    /*
+     * The shared mapping of the whole file, the header followed by the owners.
+     */
+    std::byte* m_mapping = nullptr;
+    std::size_t m_mapping_size = 0;
+}; // class mapped_arena
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace util
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // PROPERTY_PROPERTY_MAPPED_H
@@ -0,0 +1,701 @@
+/**
+ * @file        property_observable.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of the observable storage policy of property
+ *              class.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef PROPERTY_PROPERTY_OBSERVABLE_H
+#define PROPERTY_PROPERTY_OBSERVABLE_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory_resource>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "property.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace util {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Store the value together with a fixed number of change subscribers, which are called with
+ * the old and the new value on every write. The subscribers are stored inline, without heap
+ * allocations, and a write without subscribers costs a single branch.
+ *
+ * @tparam TCapacity The maximum number of simultaneous subscribers.
+ */
+template <std::size_t TCapacity = 4>
+class observable
+{ };
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <std::size_t TCapacity>
+inline constexpr bool enable_storage_policy<observable<TCapacity>> = true;
+
+/**
+ * @internal
+ * @class       change_callback
+ * @brief       The internal class change_callback keeps a small trivially copyable callable
+ *              (e.g. a lambda capturing a pointer or two) in an inline buffer.
+ *
+ * @tparam T    The value type.
+ */
+template <typename T>
+class change_callback
+{
+    static constexpr std::size_t buffer_size = 2 * sizeof(void*);
+    using invoke_type = void (*)(const void*, const T&, const T&);
+
+public:
+    template <typename TFunction>
+    static constexpr bool is_storable =
+        std::is_trivially_copyable_v<TFunction>
+        && sizeof(TFunction) <= buffer_size
+        && alignof(TFunction) <= alignof(void*)
+        && std::is_invocable_v<const TFunction&, const T&, const T&>;
+
+    change_callback() = default;
+
+    template <typename TFunction>
+        requires(is_storable<TFunction>)
+    explicit change_callback(TFunction function) noexcept
+        : m_invoke { [](const void* buffer, const T& old_value, const T& new_value) {
+            (*static_cast<const TFunction*>(buffer))(old_value, new_value);
+        } }
+    {
+        ::new (static_cast<void*>(m_buffer)) TFunction(function);
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return m_invoke != nullptr;
+    }
+
+    void operator()(const T& old_value, const T& new_value) const
+    {
+        m_invoke(m_buffer, old_value, new_value);
+    }
+
+private:
+    invoke_type m_invoke = nullptr;
+    alignas(void*) std::byte m_buffer[buffer_size] {};
+}; // class change_callback
+
+/**
+ * @internal
+ * @class       batch_state
+ * @brief       The internal class batch_state keeps the changes recorded on the calling thread
+ *              while a property_batch is alive. The old values and the changes are placed in
+ *              an arena with an inline initial buffer, so small batches do not allocate, and
+ *              the changes do not move until the batch ends.
+ */
+class batch_state
+{
+public:
+    /*
+     * The recorded change, the storage is reset by the storage destroyed before the dispatch,
+     * possibly on another thread.
+     */
+    struct pending_change
+    {
+        std::atomic<void*> storage;
+        void* old_value;
+        void (*dispatch)(void* storage, void* old_value);
+        void (*discard)(void* old_value);
+    };
+
+public:
+    [[nodiscard]] static batch_state& current() noexcept
+    {
+        thread_local batch_state state;
+        return state;
+    }
+
+    [[nodiscard]] bool is_active() const noexcept
+    {
+        return m_depth > 0;
+    }
+
+    void begin() noexcept
+    {
+        ++m_depth;
+    }
+
+    /**
+     * Closes the batch, the outermost one dispatches the recorded changes. All changes are
+     * dispatched even if a subscriber throws, then the first exception is rethrown.
+     */
+    void end()
+    {
+        if (--m_depth != 0 || m_is_dispatching)
+        {
+            return;
+        }
+        std::exception_ptr error;
+        m_is_dispatching = true;
+        // The subscribers can write again, the writes of the nested batches are collected
+        // into m_changes and dispatched by the next iteration.
+        while (!m_changes.empty())
+        {
+            std::pmr::vector<pending_change*> changes { std::move(m_changes), &m_arena };
+            m_changes = std::pmr::vector<pending_change*> { &m_arena };
+            for (auto* change : changes)
+            {
+                auto* storage = change->storage.exchange(nullptr, std::memory_order_acquire);
+                if (storage == nullptr)
+                {
+                    change->discard(change->old_value);
+                    continue;
+                }
+                try
+                {
+                    change->dispatch(storage, change->old_value);
+                }
+                catch (...)
+                {
+                    if (!error)
+                    {
+                        error = std::current_exception();
+                    }
+                }
+            }
+        }
+        m_is_dispatching = false;
+        m_changes = std::pmr::vector<pending_change*> { &m_arena };
+        m_arena.release();
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    /**
+     * Records the old value of the storage, which is dispatched when the batch ends.
+     *
+     * @return The recorded change, for the storage destroyed before the dispatch to cancel it.
+     */
+    template <typename TStorage, typename T>
+    pending_change* record(TStorage* storage, const T& old_value)
+    {
+        void* memory = m_arena.allocate(sizeof(T), alignof(T));
+        auto* value = ::new (memory) T(old_value);
+        auto* change = ::new (m_arena.allocate(sizeof(pending_change), alignof(pending_change)))
+            pending_change {
+                storage,
+                value,
+                [](void* storage, void* old_value) {
+                    auto* value = static_cast<T*>(old_value);
+                    try
+                    {
+                        static_cast<TStorage*>(storage)->dispatch_batched(*value);
+                    }
+                    catch (...)
+                    {
+                        value->~T();
+                        throw;
+                    }
+                    value->~T();
+                },
+                [](void* old_value) {
+                    static_cast<T*>(old_value)->~T();
+                } };
+        try
+        {
+            m_changes.push_back(change);
+        }
+        catch (...)
+        {
+            value->~T();
+            throw;
+        }
+        return change;
+    }
+
+    /**
+     * Forgets the change of the destroyed storage, the old value is discarded by the thread,
+     * which has recorded it, when its batch ends.
+     */
+    static void cancel(pending_change& change) noexcept
+    {
+        change.storage.store(nullptr, std::memory_order_release);
+    }
+
+    /**
+     * Moves the change to the storage constructed from the recorded one.
+     */
+    static void relocate(pending_change& change, void* storage) noexcept
+    {
+        change.storage.store(storage, std::memory_order_release);
+    }
+
+private:
+    batch_state() = default;
+
+private:
+    /*
+     * The initial arena buffer.
+     */
+    std::array<std::byte, 4096> m_buffer;
+
+    /*
+     * The arena of the old values and of the change list.
+     */
+    std::pmr::monotonic_buffer_resource m_arena { m_buffer.data(), m_buffer.size() };
+
+    /*
+     * The changes recorded by the open batches.
+     */
+    std::pmr::vector<pending_change*> m_changes { &m_arena };
+
+    /*
+     * True while the outermost batch dispatches the changes.
+     */
+    bool m_is_dispatching = false;
+
+    /*
+     * The number of the alive property_batch objects.
+     */
+    std::size_t m_depth = 0;
+}; // class batch_state
+
+/**
+ * @internal
+ * @class       observable_storage
+ * @brief       The internal class observable_storage stores the value and the subscribers,
+ *              and notifies the subscribers on the writes.
+ *
+ * @tparam T    The value type.
+ * @tparam TCapacity The maximum number of subscribers.
+ */
+template <typename T, std::size_t TCapacity>
+class observable_storage
+{
+    friend class batch_state;
+
+protected:
+    template <typename... TArgs>
+    explicit observable_storage(std::in_place_t, TArgs&&... args)
+        noexcept(std::is_nothrow_constructible_v<T, TArgs...>)
+        : m_value(std::forward<TArgs>(args)...)
+    {
+    }
+
+    /*
+     * The copies transfer the value only, the subscribers stay with the source. The moves take
+     * the subscribers and the change recorded by the open batch too, so the moved storage, e.g.
+     * in a reallocated vector, is notified when the batch ends.
+     */
+    observable_storage(const observable_storage& other)
+        : m_value { other.m_value }
+    {
+    }
+
+    observable_storage(observable_storage&& other)
+        noexcept(std::is_nothrow_move_constructible_v<T>)
+        : m_value { std::move(other.m_value) }
+        , m_subscriber_count { std::exchange(other.m_subscriber_count, 0) }
+        , m_pending { std::exchange(other.m_pending, nullptr) }
+        , m_subscribers { std::exchange(other.m_subscribers, {}) }
+    {
+        if (m_pending != nullptr)
+        {
+            batch_state::relocate(*m_pending, this);
+        }
+    }
+
+    observable_storage& operator=(const observable_storage& other)
+    {
+        assign(other.m_value);
+        return *this;
+    }
+
+    observable_storage& operator=(observable_storage&& other)
+    {
+        assign(std::move(other.m_value));
+        return *this;
+    }
+
+    ~observable_storage()
+    {
+        // The change may be recorded by the batch of another thread, so it is reached through
+        // the pointer, not through the batch of the calling thread.
+        if (m_pending != nullptr)
+        {
+            batch_state::cancel(*m_pending);
+        }
+    }
+
+    [[nodiscard]] const T& value() const noexcept
+    {
+        return m_value;
+    }
+
+    template <typename TOther>
+    void assign(TOther&& new_value)
+    {
+        if (m_subscriber_count == 0)
+        {
+            m_value = std::forward<TOther>(new_value);
+            return;
+        }
+        if (record_batched())
+        {
+            m_value = std::forward<TOther>(new_value);
+            return;
+        }
+        T old_value { m_value };
+        m_value = std::forward<TOther>(new_value);
+        notify(old_value);
+    }
+
+    template <typename TFunction>
+    void modify(TFunction&& function)
+    {
+        if (m_subscriber_count == 0)
+        {
+            std::forward<TFunction>(function)(m_value);
+            return;
+        }
+        if (record_batched())
+        {
+            std::forward<TFunction>(function)(m_value);
+            return;
+        }
+        T old_value { m_value };
+        std::forward<TFunction>(function)(m_value);
+        notify(old_value);
+    }
+
+    template <typename TFunction>
+    std::optional<std::size_t> subscribe(TFunction function) noexcept
+    {
+        for (std::size_t i = 0; i < TCapacity; ++i)
+        {
+            if (!m_subscribers[i])
+            {
+                m_subscribers[i] = change_callback<T> { function };
+                ++m_subscriber_count;
+                return i;
+            }
+        }
+        return std::nullopt;
+    }
+
+    void unsubscribe(std::size_t subscription) noexcept
+    {
+        if (subscription < TCapacity && m_subscribers[subscription])
+        {
+            m_subscribers[subscription] = change_callback<T> {};
+            --m_subscriber_count;
+        }
+    }
+
+    void notify(const T& old_value) const
+    {
+        for (const auto& subscriber : m_subscribers)
+        {
+            if (subscriber)
+            {
+                subscriber(old_value, m_value);
+            }
+        }
+    }
+
+private:
+    /*
+     * Returns true if a batch is open on the calling thread, in which case the value before
+     * the first write of the batch is recorded and the notification is postponed.
+     */
+    bool record_batched()
+    {
+        auto& batch = batch_state::current();
+        if (!batch.is_active())
+        {
+            return false;
+        }
+        if (m_pending == nullptr)
+        {
+            m_pending = batch.record(this, m_value);
+        }
+        return true;
+    }
+
+    void dispatch_batched(const T& old_value)
+    {
+        m_pending = nullptr;
+        notify(old_value);
+    }
+
+private:
+    /*
+     * The stored value.
+     */
+    T m_value;
+
+    /*
+     * The number of the active subscribers.
+     */
+    std::uint32_t m_subscriber_count = 0;
+
+    /*
+     * The change recorded by the open batch, null if there is none.
+     */
+    batch_state::pending_change* m_pending = nullptr;
+
+    /*
+     * The subscriber slots, the empty slots have no callable.
+     */
+    std::array<change_callback<T>, TCapacity> m_subscribers {};
+}; // class observable_storage
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @class          property_batch
+ * @brief          Postpones and coalesces the notifications of the observable properties.
+ * @details        While a batch is alive, the writes to the observable properties on the
+ *                 calling thread are applied but not dispatched. When the outermost batch ends,
+ *                 every changed property notifies its subscribers once, with the value before
+ *                 the first write of the batch and the final value. The batches can be nested.
+ *                 The batch ends with commit, which rethrows the exception of a subscriber, or
+ *                 with the destructor, which ignores the exceptions of the subscribers.
+ * @example        {
+ *                     util::property_batch batch;
+ *                     obj.width = 10;
+ *                     obj.height = 20;
+ *                     obj.width = 30;
+ *                     batch.commit();
+ *                 } // Notifies the width subscribers once (old, 30) and the height ones once.
+ */
+class property_batch
+{
+public:
+    property_batch() noexcept
+    {
+        impl::batch_state::current().begin();
+    }
+
+    ~property_batch()
+    {
+        if (m_is_open)
+        {
+            try
+            {
+                impl::batch_state::current().end();
+            }
+            catch (...)
+            {
+                // The destructor can not report the exception of a subscriber, commit does.
+            }
+        }
+    }
+
+    property_batch(property_batch&&) = delete;
+    property_batch(const property_batch&) = delete;
+    property_batch& operator=(property_batch&&) = delete;
+    property_batch& operator=(const property_batch&) = delete;
+
+    /**
+     * Ends the batch, the outermost one notifies the subscribers. Every changed property is
+     * notified even if a subscriber throws, then the first exception is rethrown. Has no effect
+     * on the ended batch.
+     */
+    void commit()
+    {
+        if (std::exchange(m_is_open, false))
+        {
+            impl::batch_state::current().end();
+        }
+    }
+
+private:
+    bool m_is_open = true;
+}; // class property_batch
+
+/**
+ * @class          property
+ * @brief          The property specialization which notifies subscribers about the writes.
+ * @details        The read accessors and subscribe/unsubscribe follow the get part of the
+ *                 access policy, the writes (the assignments and modify) follow the set part.
+ *                 Every write calls the subscribers with the old and the new value. The value
+ *                 is exposed for reading only, so it can not be changed bypassing the
+ *                 notifications. The subscribers are callables of at most two pointers size,
+ *                 e.g. a lambda capturing this. Copying the property copies the value only,
+ *                 the move constructor moves the subscribers and the batched change too.
+ *                 The notifications of the writes made while a property_batch is alive are
+ *                 coalesced and postponed until the batch ends.
+ * @example        struct widget
+ *                 {
+ *                     util::property<widget, std::string, util::public_get_set,
+ *                                    util::observable<>> title;
+ *                 };
+ *                 auto id = w.title.subscribe([this](const auto& old, const auto& title) {
+ *                     invalidate_layout();
+ *                 });
+ *                 w.title = "Hello";  // Calls invalidate_layout.
+ *                 w.title.unsubscribe(*id);
+ * @tparam TOwner  is the type of owner, which should have all accesses.
+ * @tparam TValue  is the type of property value.
+ * @tparam TAccessPolicy is the access policy for the property.
+ * @tparam TCapacity is the maximum number of subscribers.
+ */
+template <typename TOwner, typename TValue, typename TAccessPolicy, std::size_t TCapacity>
+class property<TOwner, TValue, TAccessPolicy, observable<TCapacity>>
+    : private impl::observable_storage<TValue, TCapacity>
+{
+    friend TOwner;
+
+    /*
+     * The wrapping storage policies (e.g. cache_aligned) forward to the wrapped property.
+     */
+    template <typename, typename, typename TOtherAccessPolicy, typename TOtherStoragePolicy>
+        requires(impl::is_access_policy<TOtherAccessPolicy>
+                 && impl::is_storage_policy<TOtherStoragePolicy>)
+    friend class property;
+
+    static constexpr bool is_public_get = impl::is_public_get<TAccessPolicy>;
+    static constexpr bool is_public_set = impl::is_public_set<TAccessPolicy>;
+    using storage_type = impl::observable_storage<TValue, TCapacity>;
+
+    template <typename TFunction>
+    static constexpr bool is_subscriber = impl::change_callback<TValue>::template
+                                              is_storable<TFunction>;
+
+public:
+    property() noexcept(std::is_nothrow_default_constructible_v<TValue>)
+        requires(std::is_default_constructible_v<TValue>)
+        : storage_type { std::in_place }
+    {
+    }
+
+    property(TValue value) noexcept(std::is_nothrow_move_constructible_v<TValue>)
+        : storage_type { std::in_place, std::move(value) }
+    {
+    }
+
+    template <typename... TArgs>
+        requires(std::is_constructible_v<TValue, TArgs...>)
+    explicit property(std::in_place_t, TArgs&&... args)
+        noexcept(std::is_nothrow_constructible_v<TValue, TArgs...>)
+        : storage_type { std::in_place, std::forward<TArgs>(args)... }
+    {
+    }
+
+    ~property() = default;
+    property(property&&) = default;
+    property(const property&) = default;
+    property& operator=(property&&) = default;
+    property& operator=(const property&) = default;
+
+public:
+    [[nodiscard]] const TValue& get() const noexcept requires(is_public_get)
+    {
+        return storage_type::value();
+    }
+
+    operator const TValue&() const noexcept requires(is_public_get)
+    {
+        return storage_type::value();
+    }
+
+    /**
+     * Adds the subscriber, returns its id or nothing if all subscriber slots are taken.
+     */
+    template <typename TFunction>
+        requires(is_public_get && is_subscriber<TFunction>)
+    [[nodiscard]] std::optional<std::size_t> subscribe(TFunction function) noexcept
+    {
+        return storage_type::subscribe(function);
+    }
+
+    void unsubscribe(std::size_t subscription) noexcept requires(is_public_get)
+    {
+        storage_type::unsubscribe(subscription);
+    }
+
+private:
+    [[nodiscard]] const TValue& get() const noexcept requires(!is_public_get)
+    {
+        return storage_type::value();
+    }
+
+    operator const TValue&() const noexcept requires(!is_public_get)
+    {
+        return storage_type::value();
+    }
+
+    template <typename TFunction>
+        requires(!is_public_get && is_subscriber<TFunction>)
+    [[nodiscard]] std::optional<std::size_t> subscribe(TFunction function) noexcept
+    {
+        return storage_type::subscribe(function);
+    }
+
+    void unsubscribe(std::size_t subscription) noexcept requires(!is_public_get)
+    {
+        storage_type::unsubscribe(subscription);
+    }
+
+public:
+    const TValue& operator=(const TValue& new_value) requires(is_public_set)
+    {
+        storage_type::assign(new_value);
+        return storage_type::value();
+    }
+
+    const TValue& operator=(TValue&& new_value) requires(is_public_set)
+    {
+        storage_type::assign(std::move(new_value));
+        return storage_type::value();
+    }
+
+    template <typename TFunction>
+        requires(is_public_set && std::is_invocable_v<TFunction, TValue&>)
+    void modify(TFunction&& function)
+    {
+        storage_type::modify(std::forward<TFunction>(function));
+    }
+
+private:
+    const TValue& operator=(const TValue& new_value) requires(!is_public_set)
+    {
+        storage_type::assign(new_value);
+        return storage_type::value();
+    }
+
+    const TValue& operator=(TValue&& new_value) requires(!is_public_set)
+    {
+        storage_type::assign(std::move(new_value));
+        return storage_type::value();
+    }
+
+    template <typename TFunction>
+        requires(!is_public_set && std::is_invocable_v<TFunction, TValue&>)
+    void modify(TFunction&& function)
+    {
+        storage_type::modify(std::forward<TFunction>(function));
+    }
+}; // class property<TOwner, TValue, TAccessPolicy, observable<TCapacity>>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace util
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // PROPERTY_PROPERTY_OBSERVABLE_H
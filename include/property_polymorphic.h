@@ -0,0 +1,496 @@
+/**
+ * @file        property_polymorphic.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of the polymorphic storage policy of property
+ *              class.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef PROPERTY_PROPERTY_POLYMORPHIC_H
+#define PROPERTY_PROPERTY_POLYMORPHIC_H
+
+#include <concepts>
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "property.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace util {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Store an object of a type derived from the value type by value. The objects, which fit the
+ * inline buffer, are stored inside the property, the larger ones in the arena of the property.
+ *
+ * @tparam TSize  The size of the inline buffer.
+ * @tparam TAlign The alignment of the inline buffer.
+ */
+template <std::size_t TSize = 3 * sizeof(void*), std::size_t TAlign = alignof(std::max_align_t)>
+class polymorphic
+{ };
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <std::size_t TSize, std::size_t TAlign>
+inline constexpr bool enable_storage_policy<polymorphic<TSize, TAlign>> = true;
+
+/**
+ * @internal
+ * @brief       The operations of the concrete type of the stored object, one static table per
+ *              type, so the storage keeps a single pointer instead of a virtual base.
+ */
+template <typename TBase>
+struct polymorphic_ops
+{
+    std::size_t size;
+    std::size_t alignment;
+    bool is_inline;
+    TBase* (*copy)(const TBase& source, void* destination);
+
+    /*
+     * Used only for the inline objects, their moves are noexcept.
+     */
+    TBase* (*move)(TBase& source, void* destination) noexcept;
+    void (*destroy)(TBase& object) noexcept;
+};
+
+/**
+ * @internal
+ * @class       polymorphic_storage
+ * @brief       The internal class polymorphic_storage keeps the object of a type derived from
+ *              TBase in the inline buffer or in the arena.
+ * @details     The object is inline when it fits the buffer and its move is noexcept, so moving
+ *              the storage never allocates and never throws. The objects in the arena are moved
+ *              by passing the pointer, together with the arena.
+ *
+ * @tparam TBase  The type of the base class.
+ * @tparam TSize  The size of the inline buffer.
+ * @tparam TAlign The alignment of the inline buffer.
+ */
+template <typename TBase, std::size_t TSize, std::size_t TAlign>
+class polymorphic_storage
+{
+    template <typename TDerived>
+    static constexpr bool fits_inline =
+        sizeof(TDerived) <= TSize && TAlign % alignof(TDerived) == 0
+        && std::is_nothrow_move_constructible_v<TDerived>;
+
+    template <typename TDerived>
+    static constexpr polymorphic_ops<TBase> ops_of {
+        sizeof(TDerived),
+        alignof(TDerived),
+        fits_inline<TDerived>,
+        [](const TBase& source, void* destination) -> TBase*
+        {
+            return ::new (destination) TDerived(static_cast<const TDerived&>(source));
+        },
+        [](TBase& source, void* destination) noexcept -> TBase*
+        {
+            return ::new (destination) TDerived(std::move(static_cast<TDerived&>(source)));
+        },
+        [](TBase& object) noexcept
+        {
+            static_cast<TDerived&>(object).~TDerived();
+        }
+    };
+
+protected:
+    explicit polymorphic_storage(std::pmr::memory_resource* arena) noexcept
+        : m_arena { arena }
+    {
+    }
+
+    polymorphic_storage(const polymorphic_storage& other)
+        : m_arena { other.m_arena }
+    {
+        copy_from(other);
+    }
+
+    polymorphic_storage(polymorphic_storage&& other) noexcept
+        : m_arena { other.m_arena }
+    {
+        move_from(other);
+    }
+
+    polymorphic_storage& operator=(const polymorphic_storage& other)
+    {
+        if (this != &other)
+        {
+            // The copy is made aside, so the object is kept if the copy throws.
+            polymorphic_storage copy { m_arena };
+            copy.copy_from(other);
+            reset();
+            move_from(copy);
+        }
+        return *this;
+    }
+
+    polymorphic_storage& operator=(polymorphic_storage&& other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+            move_from(other);
+        }
+        return *this;
+    }
+
+    ~polymorphic_storage()
+    {
+        reset();
+    }
+
+    /**
+     * Replaces the object with the new one of the given type. The new object is constructed
+     * before the old one is destroyed, so the arguments may refer to the old object, and the
+     * old object is kept if the constructor throws.
+     */
+    template <typename TDerived, typename... TArgs>
+    TDerived& emplace(TArgs&&... args)
+    {
+        if constexpr (fits_inline<TDerived>)
+        {
+            // The buffer is taken by the old object, the new one is moved in, without throwing.
+            TDerived temporary(std::forward<TArgs>(args)...);
+            reset();
+            auto* object = ::new (static_cast<void*>(m_buffer)) TDerived(std::move(temporary));
+            install(object, m_buffer, ops_of<TDerived>);
+            return *object;
+        }
+        else
+        {
+            void* memory = m_arena->allocate(sizeof(TDerived), alignof(TDerived));
+            TDerived* object;
+            try
+            {
+                object = ::new (memory) TDerived(std::forward<TArgs>(args)...);
+            }
+            catch (...)
+            {
+                m_arena->deallocate(memory, sizeof(TDerived), alignof(TDerived));
+                throw;
+            }
+            reset();
+            install(object, memory, ops_of<TDerived>);
+            return *object;
+        }
+    }
+
+    /**
+     * Destroys the object, the storage becomes empty.
+     */
+    void reset() noexcept
+    {
+        if (m_object == nullptr)
+        {
+            return;
+        }
+        m_ops->destroy(*m_object);
+        if (!m_ops->is_inline)
+        {
+            // The object in the arena is of the concrete type, its address is the allocated one.
+            m_arena->deallocate(m_allocation, m_ops->size, m_ops->alignment);
+        }
+        m_object = nullptr;
+        m_ops = nullptr;
+    }
+
+    [[nodiscard]] TBase& object() const noexcept
+    {
+        return *m_object;
+    }
+
+    [[nodiscard]] bool has_object() const noexcept
+    {
+        return m_object != nullptr;
+    }
+
+    [[nodiscard]] bool is_inline() const noexcept
+    {
+        return m_ops != nullptr && m_ops->is_inline;
+    }
+
+private:
+    void install(TBase* object, void* allocation, const polymorphic_ops<TBase>& ops) noexcept
+    {
+        m_object = object;
+        m_allocation = allocation;
+        m_ops = &ops;
+    }
+
+    void copy_from(const polymorphic_storage& other)
+    {
+        if (other.m_object == nullptr)
+        {
+            return;
+        }
+        const auto& ops = *other.m_ops;
+        void* memory = ops.is_inline ? static_cast<void*>(m_buffer)
+                                     : m_arena->allocate(ops.size, ops.alignment);
+        try
+        {
+            m_object = ops.copy(*other.m_object, memory);
+        }
+        catch (...)
+        {
+            if (!ops.is_inline)
+            {
+                m_arena->deallocate(memory, ops.size, ops.alignment);
+            }
+            throw;
+        }
+        m_allocation = memory;
+        m_ops = &ops;
+    }
+
+    /**
+     * Takes the object and the arena of the other storage, which becomes empty. The arena
+     * objects are taken by the pointer.
+     */
+    void move_from(polymorphic_storage& other) noexcept
+    {
+        m_arena = other.m_arena;
+        if (other.m_object == nullptr)
+        {
+            return;
+        }
+        const auto& ops = *other.m_ops;
+        if (ops.is_inline)
+        {
+            m_object = ops.move(*other.m_object, m_buffer);
+            m_allocation = m_buffer;
+            other.reset();
+        }
+        else
+        {
+            m_object = std::exchange(other.m_object, nullptr);
+            m_allocation = other.m_allocation;
+            other.m_ops = nullptr;
+        }
+        m_ops = &ops;
+    }
+
+private:
+    alignas(TAlign) std::byte m_buffer[TSize];
+
+    /*
+     * The stored object as the base class, null if the storage is empty.
+     */
+    TBase* m_object = nullptr;
+
+    /*
+     * The operations of the concrete type, and the address of the concrete object.
+     */
+    const polymorphic_ops<TBase>* m_ops = nullptr;
+    void* m_allocation = nullptr;
+
+    /*
+     * The arena of the objects, which do not fit the buffer.
+     */
+    std::pmr::memory_resource* m_arena;
+}; // class polymorphic_storage
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @class          property
+ * @brief          The property specialization which holds a polymorphic object by value.
+ * @details        The value type is the base class, the property stores an object of any
+ *                 copyable type derived from it. The objects, which fit the inline buffer and
+ *                 have noexcept moves, are stored inside the property, without allocations and
+ *                 pointer chasing. The larger ones are allocated in the arena passed to the
+ *                 constructor, std::pmr::get_default_resource() by default, so the owners may
+ *                 place them e.g. in a std::pmr::monotonic_buffer_resource. The copies and the
+ *                 moves take the arena of the source, the copy assignment keeps its own. The
+ *                 moved from property is empty. The reads follow the get part of the access
+ *                 policy, emplace and the assignments the set part.
+ * @example        struct unit
+ *                 {
+ *                     util::property<unit, strategy, util::public_get_set,
+ *                                    util::polymorphic<32>> behaviour { idle {} };
+ *                 };
+ *                 u.behaviour->update(u);
+ *                 u.behaviour.emplace<patrol>(route);
+ * @tparam TOwner  is the type of owner, which should have all accesses.
+ * @tparam TValue  is the base class of the stored objects.
+ * @tparam TAccessPolicy is the access policy for the property.
+ * @tparam TSize   is the size of the inline buffer.
+ * @tparam TAlign  is the alignment of the inline buffer.
+ */
+template <typename TOwner, typename TValue, typename TAccessPolicy, std::size_t TSize,
+          std::size_t TAlign>
+class property<TOwner, TValue, TAccessPolicy, polymorphic<TSize, TAlign>>
+    : private impl::polymorphic_storage<TValue, TSize, TAlign>
+{
+    friend TOwner;
+
+    /*
+     * The wrapping storage policies (e.g. cache_aligned) forward to the wrapped property.
+     */
+    template <typename, typename, typename TOtherAccessPolicy, typename TOtherStoragePolicy>
+        requires(impl::is_access_policy<TOtherAccessPolicy>
+                 && impl::is_storage_policy<TOtherStoragePolicy>)
+    friend class property;
+
+    static constexpr bool is_public_get = impl::is_public_get<TAccessPolicy>;
+    static constexpr bool is_public_set = impl::is_public_set<TAccessPolicy>;
+    using storage_type = impl::polymorphic_storage<TValue, TSize, TAlign>;
+
+    /*
+     * The types, which the property can store.
+     */
+    template <typename TDerived>
+    static constexpr bool is_implementation =
+        std::derived_from<TDerived, TValue> && std::is_copy_constructible_v<TDerived>
+        && !std::is_same_v<TDerived, property>;
+
+public:
+    template <typename TDerived>
+        requires(is_implementation<std::remove_cvref_t<TDerived>>)
+    property(TDerived&& value)
+        : storage_type { std::pmr::get_default_resource() }
+    {
+        this->template emplace<std::remove_cvref_t<TDerived>>(std::forward<TDerived>(value));
+    }
+
+    /**
+     * Constructs the object of the given type in place.
+     *
+     * @param args The arguments forwarded to the object constructor.
+     */
+    template <typename TDerived, typename... TArgs>
+        requires(is_implementation<TDerived> && std::is_constructible_v<TDerived, TArgs...>)
+    explicit property(std::in_place_type_t<TDerived>, TArgs&&... args)
+        : storage_type { std::pmr::get_default_resource() }
+    {
+        this->template emplace<TDerived>(std::forward<TArgs>(args)...);
+    }
+
+    /**
+     * Constructs the object of the given type in place, the large objects are allocated in the
+     * arena.
+     *
+     * @param arena The arena, which should outlive the property.
+     * @param args  The arguments forwarded to the object constructor.
+     */
+    template <typename TDerived, typename... TArgs>
+        requires(is_implementation<TDerived> && std::is_constructible_v<TDerived, TArgs...>)
+    property(std::pmr::memory_resource& arena, std::in_place_type_t<TDerived>, TArgs&&... args)
+        : storage_type { &arena }
+    {
+        this->template emplace<TDerived>(std::forward<TArgs>(args)...);
+    }
+
+    ~property() = default;
+    property(property&&) = default;
+    property(const property&) = default;
+    property& operator=(property&&) = default;
+    property& operator=(const property&) = default;
+
+public:
+    /*
+     * The property is empty only after it was moved from.
+     */
+    [[nodiscard]] bool has_value() const noexcept
+    {
+        return this->has_object();
+    }
+
+    /*
+     * Whether the object is stored in the inline buffer, for the diagnostics.
+     */
+    using storage_type::is_inline;
+
+public:
+    [[nodiscard]] const TValue& get() const noexcept requires(is_public_get)
+    {
+        return this->object();
+    }
+
+    const TValue* operator->() const noexcept requires(is_public_get)
+    {
+        return &this->object();
+    }
+
+    operator TValue&() noexcept requires(is_public_get && is_public_set)
+    {
+        return this->object();
+    }
+
+    TValue* operator->() noexcept requires(is_public_get && is_public_set)
+    {
+        return &this->object();
+    }
+
+    operator const TValue&() const noexcept requires(is_public_get && !is_public_set)
+    {
+        return this->object();
+    }
+
+private:
+    [[nodiscard]] const TValue& get() const noexcept requires(!is_public_get)
+    {
+        return this->object();
+    }
+
+    operator TValue&() noexcept requires(!is_public_get)
+    {
+        return this->object();
+    }
+
+    TValue* operator->() noexcept requires(!is_public_get)
+    {
+        return &this->object();
+    }
+
+public:
+    /**
+     * Replaces the object with the new one of the given type, constructed in place.
+     */
+    template <typename TDerived, typename... TArgs>
+        requires(is_public_set && is_implementation<TDerived>
+                 && std::is_constructible_v<TDerived, TArgs...>)
+    TDerived& emplace(TArgs&&... args)
+    {
+        return storage_type::template emplace<TDerived>(std::forward<TArgs>(args)...);
+    }
+
+    template <typename TDerived>
+        requires(is_public_set && is_implementation<std::remove_cvref_t<TDerived>>)
+    TValue& operator=(TDerived&& value)
+    {
+        return emplace<std::remove_cvref_t<TDerived>>(std::forward<TDerived>(value));
+    }
+
+private:
+    template <typename TDerived, typename... TArgs>
+        requires(!is_public_set && is_implementation<TDerived>
+                 && std::is_constructible_v<TDerived, TArgs...>)
+    TDerived& emplace(TArgs&&... args)
+    {
+        return storage_type::template emplace<TDerived>(std::forward<TArgs>(args)...);
+    }
+
+    template <typename TDerived>
+        requires(!is_public_set && is_implementation<std::remove_cvref_t<TDerived>>)
+    TValue& operator=(TDerived&& value)
+    {
+        return emplace<std::remove_cvref_t<TDerived>>(std::forward<TDerived>(value));
+    }
+}; // class property<TOwner, TValue, TAccessPolicy, polymorphic<TSize, TAlign>>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace util
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // PROPERTY_PROPERTY_POLYMORPHIC_H
@@ -0,0 +1,256 @@
+/**
+ * @file        property_reflection.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of the compile-time property lists of owners.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef PROPERTY_PROPERTY_REFLECTION_H
+#define PROPERTY_PROPERTY_REFLECTION_H
+
+#include <algorithm>
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "property.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace util {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @class          fixed_string
+ * @brief          The string literal, which can be passed as a template argument.
+ * @tparam TSize   is the size of the literal, including the terminating null.
+ */
+template <std::size_t TSize>
+struct fixed_string
+{
+    constexpr fixed_string(const char (&text)[TSize]) noexcept
+    {
+        std::copy_n(text, TSize, data);
+    }
+
+    [[nodiscard]] constexpr std::string_view view() const noexcept
+    {
+        return { data, TSize - 1 };
+    }
+
+    /*
+     * The characters of the literal, the member is public to keep the class structural.
+     */
+    char data[TSize] {};
+}; // struct fixed_string
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @internal
+ * @brief       Splits a property type into its template arguments.
+ */
+template <typename T>
+struct property_traits;
+
+template <typename TOwner, typename TValue, typename TAccessPolicy, typename TStoragePolicy>
+struct property_traits<property<TOwner, TValue, TAccessPolicy, TStoragePolicy>>
+{
+    using owner_type = TOwner;
+    using value_type = TValue;
+    using access_policy = TAccessPolicy;
+    using storage_policy = TStoragePolicy;
+};
+
+/**
+ * @internal
+ * @brief       Splits a pointer to data member into the class and the member types.
+ */
+template <typename T>
+struct member_pointer_traits;
+
+template <typename TClass, typename TMember>
+struct member_pointer_traits<TMember TClass::*>
+{
+    using class_type = TClass;
+    using member_type = TMember;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @class          member
+ * @brief          The compile-time descriptor of one property of an owner.
+ * @tparam TName   is the name of the property.
+ * @tparam TMember is the pointer to the property member of the owner.
+ */
+template <fixed_string TName, auto TMember>
+struct member
+{
+    using owner_type = typename impl::member_pointer_traits<decltype(TMember)>::class_type;
+    using property_type = typename impl::member_pointer_traits<decltype(TMember)>::member_type;
+    using value_type = typename impl::property_traits<property_type>::value_type;
+    using access_policy = typename impl::property_traits<property_type>::access_policy;
+    using storage_policy = typename impl::property_traits<property_type>::storage_policy;
+
+    static constexpr std::string_view name = TName.view();
+    static constexpr auto pointer = TMember;
+}; // struct member
+
+/**
+ * @class          property_list
+ * @brief          The list of the property descriptors of an owner, in the declaration order.
+ * @tparam TMembers is the descriptors, the instances of util::member.
+ */
+template <typename... TMembers>
+struct property_list
+{
+    static constexpr std::size_t size = sizeof...(TMembers);
+}; // struct property_list
+
+/**
+ * The property list of an owner. By default it is the nested type TOwner::properties, the owners
+ * which can not be changed may specialize the trait instead.
+ *
+ * @example        struct player
+ *                 {
+ *                     util::property<player, int, util::public_get_set> health;
+ *                     util::property<player, std::string, util::public_get> name;
+ *
+ *                     using properties = util::property_list<
+ *                         util::member<"health", &player::health>,
+ *                         util::member<"name", &player::name>>;
+ *                 };
+ */
+template <typename TOwner>
+struct reflect
+{ };
+
+template <typename TOwner>
+    requires requires { typename TOwner::properties; }
+struct reflect<TOwner>
+{
+    using type = typename TOwner::properties;
+};
+
+template <typename TOwner>
+using properties_of = typename reflect<std::remove_cv_t<TOwner>>::type;
+
+template <typename TOwner>
+concept reflectable = requires { typename properties_of<TOwner>; };
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename TOwner, typename TFunction, typename... TMembers>
+constexpr void for_each_property(TOwner& owner, TFunction& function,
+                                 property_list<TMembers...>)
+{
+    (function(TMembers {}, owner.*TMembers::pointer), ...);
+}
+
+template <typename TFunction, typename... TMembers>
+constexpr void for_each_member(TFunction& function, property_list<TMembers...>)
+{
+    (function(TMembers {}), ...);
+}
+
+template <fixed_string TName, typename... TMembers>
+constexpr std::size_t index_of(property_list<TMembers...>) noexcept
+{
+    std::size_t index = 0;
+    ((TMembers::name == TName.view() ? false : (++index, true)) && ...);
+    return index;
+}
+
+template <std::size_t TIndex, typename TFirst, typename... TRest>
+constexpr auto member_at(property_list<TFirst, TRest...>) noexcept
+{
+    if constexpr (TIndex == 0)
+    {
+        return TFirst {};
+    }
+    else
+    {
+        return member_at<TIndex - 1>(property_list<TRest...> {});
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * The number of the listed properties of the owner.
+ */
+template <reflectable TOwner>
+inline constexpr std::size_t property_count = properties_of<TOwner>::size;
+
+/**
+ * The descriptor of the listed property of the owner with the given index.
+ */
+template <reflectable TOwner, std::size_t TIndex>
+    requires(TIndex < property_count<TOwner>)
+using member_at = decltype(impl::member_at<TIndex>(properties_of<TOwner> {}));
+
+/**
+ * The index of the listed property of the owner with the given name, property_count if there
+ * is no such property.
+ */
+template <reflectable TOwner, fixed_string TName>
+inline constexpr std::size_t index_of = impl::index_of<TName>(properties_of<TOwner> {});
+
+/**
+ * Calls the function for every listed property of the owner, in the list order. The calls are
+ * unrolled at compile time, the function takes the descriptor and the property, and can use
+ * only the accessors allowed to it by the access policy of the property.
+ *
+ * @param owner    The owner, its constness is applied to the properties.
+ * @param function The function, e.g. [](auto member, auto& property) { ... }.
+ */
+template <typename TOwner, typename TFunction>
+    requires(reflectable<TOwner>)
+constexpr void for_each_property(TOwner& owner, TFunction&& function)
+{
+    impl::for_each_property(owner, function, properties_of<TOwner> {});
+}
+
+/**
+ * Calls the function for the descriptor of every listed property of the owner, in the list
+ * order, without an owner instance.
+ *
+ * @param function The function, e.g. [](auto member) { ... }.
+ */
+template <reflectable TOwner, typename TFunction>
+constexpr void for_each_member(TFunction&& function)
+{
+    impl::for_each_member(function, properties_of<TOwner> {});
+}
+
+/**
+ * Returns the listed property of the owner with the given name, the name is checked at compile
+ * time.
+ *
+ * @param owner The owner, its constness is applied to the property.
+ */
+template <fixed_string TName, typename TOwner>
+    requires(reflectable<TOwner>)
+constexpr auto& get_property(TOwner& owner) noexcept
+{
+    constexpr auto index = index_of<std::remove_cv_t<TOwner>, TName>;
+    static_assert(index < property_count<std::remove_cv_t<TOwner>>,
+                  "The owner does not list the property with the given name.");
+    return owner.*member_at<std::remove_cv_t<TOwner>, index>::pointer;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace util
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // PROPERTY_PROPERTY_REFLECTION_H
@@ -0,0 +1,335 @@
+/**
+ * @file        property_seqlock.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of the seqlock storage policy of property class.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef PROPERTY_PROPERTY_SEQLOCK_H
+#define PROPERTY_PROPERTY_SEQLOCK_H
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include "property.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace util {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Store the value behind a sequence lock. The readers copy the value optimistically and never
+ * write shared memory, the writers are serialized. Suits trivially copyable values which are
+ * too large for a lock-free std::atomic and are read much more often than written.
+ */
+class seqlock
+{ };
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <>
+inline constexpr bool enable_storage_policy<seqlock> = true;
+
+/**
+ * @internal
+ * @brief       Hints the processor that the thread is spinning.
+ */
+inline void cpu_relax() noexcept
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#endif
+}
+
+/**
+ * @internal
+ * @class       seqlock_storage
+ * @brief       The internal class seqlock_storage stores the value as an array of atomic words
+ *              guarded by a sequence counter. The counter is odd while a write is in progress.
+ *
+ * @tparam T    The value type, should be trivially copyable.
+ */
+template <typename T>
+class seqlock_storage
+{
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "The seqlock storage policy requires a trivially copyable value type.");
+
+    using word_type = std::size_t;
+    using bytes_type = std::array<std::byte, sizeof(T)>;
+    static constexpr std::size_t word_count =
+        (sizeof(T) + sizeof(word_type) - 1) / sizeof(word_type);
+
+protected:
+    template <typename... TArgs>
+    explicit seqlock_storage(std::in_place_t, TArgs&&... args)
+        noexcept(std::is_nothrow_constructible_v<T, TArgs...>)
+    {
+        write_words(T(std::forward<TArgs>(args)...));
+    }
+
+    seqlock_storage(const seqlock_storage& other) noexcept
+    {
+        write_words(other.load());
+    }
+
+    seqlock_storage& operator=(const seqlock_storage& other) noexcept
+    {
+        store(other.load());
+        return *this;
+    }
+
+    ~seqlock_storage() = default;
+
+    /**
+     * Reads a consistent copy of the value, retries while it overlaps with a write.
+     */
+    [[nodiscard]] T load() const noexcept
+    {
+        std::array<word_type, word_count> words;
+        for (;;)
+        {
+            const auto sequence = m_sequence.load(std::memory_order_acquire);
+            if (sequence & 1)
+            {
+                cpu_relax();
+                continue;
+            }
+            for (std::size_t i = 0; i < word_count; ++i)
+            {
+                words[i] = m_words[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (m_sequence.load(std::memory_order_relaxed) == sequence)
+            {
+                break;
+            }
+        }
+        bytes_type bytes;
+        std::memcpy(bytes.data(), words.data(), sizeof(T));
+        return std::bit_cast<T>(bytes);
+    }
+
+    void store(const T& value) noexcept
+    {
+        const auto sequence = lock();
+        write_words(value);
+        m_sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    /**
+     * Applies the given function to the value while the other writers are excluded. If the
+     * function throws, the value is not changed and the lock is released.
+     */
+    template <typename TFunction>
+    void update(TFunction&& function)
+    {
+        const auto sequence = lock();
+        auto value = read_words();
+        try
+        {
+            std::forward<TFunction>(function)(value);
+        }
+        catch (...)
+        {
+            m_sequence.store(sequence + 2, std::memory_order_release);
+            throw;
+        }
+        write_words(value);
+        m_sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+private:
+    /*
+     * Makes the sequence odd, returns the even sequence which was replaced.
+     */
+    std::uint64_t lock() noexcept
+    {
+        auto sequence = m_sequence.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            if (!(sequence & 1)
+                && m_sequence.compare_exchange_weak(sequence, sequence + 1,
+                                                    std::memory_order_relaxed))
+            {
+                break;
+            }
+            cpu_relax();
+            sequence = m_sequence.load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+        return sequence;
+    }
+
+    /*
+     * Reads the words, valid only for the writer holding the lock.
+     */
+    [[nodiscard]] T read_words() const noexcept
+    {
+        std::array<word_type, word_count> words;
+        for (std::size_t i = 0; i < word_count; ++i)
+        {
+            words[i] = m_words[i].load(std::memory_order_relaxed);
+        }
+        bytes_type bytes;
+        std::memcpy(bytes.data(), words.data(), sizeof(T));
+        return std::bit_cast<T>(bytes);
+    }
+
+    void write_words(const T& value) noexcept
+    {
+        std::array<word_type, word_count> words {};
+        std::memcpy(words.data(), &value, sizeof(T));
+        for (std::size_t i = 0; i < word_count; ++i)
+        {
+            m_words[i].store(words[i], std::memory_order_relaxed);
+        }
+    }
+
+private:
+    /*
+     * The sequence counter, odd while a write is in progress.
+     */
+    std::atomic<std::uint64_t> m_sequence { 0 };
+
+    /*
+     * The value representation.
+     */
+    std::array<std::atomic<word_type>, word_count> m_words;
+}; // class seqlock_storage
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @class          property
+ * @brief          The property specialization which stores the value behind a sequence lock.
+ * @details        The readers never block the writers and never write shared memory, they
+ *                 retry the copy if a write overlapped with it. The writers are serialized
+ *                 between themselves. The read accessors follow the get part of the access
+ *                 policy, store, update and the assignment follow the set part.
+ * @example        struct instrument
+ *                 {
+ *                     util::property<instrument, quote, util::public_get, util::seqlock> last;
+ *                     void on_tick(const quote& q) { last = q; }
+ *                 };
+ *                 quote q = inst.last.load();
+ * @tparam TOwner  is the type of owner, which should have all accesses.
+ * @tparam TValue  is the type of property value, should be trivially copyable.
+ * @tparam TAccessPolicy is the access policy for the property.
+ */
+template <typename TOwner, typename TValue, typename TAccessPolicy>
+class property<TOwner, TValue, TAccessPolicy, seqlock>
+    : private impl::seqlock_storage<TValue>
+{
+    friend TOwner;
+
+    /*
+     * The wrapping storage policies (e.g. cache_aligned) forward to the wrapped property.
+     */
+    template <typename, typename, typename TOtherAccessPolicy, typename TOtherStoragePolicy>
+        requires(impl::is_access_policy<TOtherAccessPolicy>
+                 && impl::is_storage_policy<TOtherStoragePolicy>)
+    friend class property;
+
+    static constexpr bool is_public_get = impl::is_public_get<TAccessPolicy>;
+    static constexpr bool is_public_set = impl::is_public_set<TAccessPolicy>;
+    using storage_type = impl::seqlock_storage<TValue>;
+
+public:
+    property() noexcept(std::is_nothrow_default_constructible_v<TValue>)
+        : storage_type { std::in_place }
+    {
+    }
+
+    property(const TValue& value) noexcept
+        : storage_type { std::in_place, value }
+    {
+    }
+
+    template <typename... TArgs>
+        requires(std::is_constructible_v<TValue, TArgs...>)
+    explicit property(std::in_place_t, TArgs&&... args)
+        noexcept(std::is_nothrow_constructible_v<TValue, TArgs...>)
+        : storage_type { std::in_place, std::forward<TArgs>(args)... }
+    {
+    }
+
+    ~property() = default;
+    property(const property&) = default;
+    property& operator=(const property&) = default;
+
+public:
+    [[nodiscard]] TValue load() const noexcept requires(is_public_get)
+    {
+        return storage_type::load();
+    }
+
+    operator TValue() const noexcept requires(is_public_get)
+    {
+        return storage_type::load();
+    }
+
+private:
+    [[nodiscard]] TValue load() const noexcept requires(!is_public_get)
+    {
+        return storage_type::load();
+    }
+
+    operator TValue() const noexcept requires(!is_public_get)
+    {
+        return storage_type::load();
+    }
+
+public:
+    void store(const TValue& new_value) noexcept requires(is_public_set)
+    {
+        storage_type::store(new_value);
+    }
+
+    void operator=(const TValue& new_value) noexcept requires(is_public_set)
+    {
+        storage_type::store(new_value);
+    }
+
+    template <typename TFunction>
+        requires(is_public_set && std::is_invocable_v<TFunction, TValue&>)
+    void update(TFunction&& function)
+    {
+        storage_type::update(std::forward<TFunction>(function));
+    }
+
+private:
+    void store(const TValue& new_value) noexcept requires(!is_public_set)
+    {
+        storage_type::store(new_value);
+    }
+
+    void operator=(const TValue& new_value) noexcept requires(!is_public_set)
+    {
+        storage_type::store(new_value);
+    }
+
+    template <typename TFunction>
+        requires(!is_public_set && std::is_invocable_v<TFunction, TValue&>)
+    void update(TFunction&& function)
+    {
+        storage_type::update(std::forward<TFunction>(function));
+    }
+}; // class property<TOwner, TValue, TAccessPolicy, seqlock>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace util
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // PROPERTY_PROPERTY_SEQLOCK_H
@@ -0,0 +1,376 @@
+/**
+ * @file        property_serialization.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of the binary serialization of the owners.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef PROPERTY_PROPERTY_SERIALIZATION_H
+#define PROPERTY_PROPERTY_SERIALIZATION_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "property.h"
+#include "property_reflection.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace util {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @internal
+ * @class       binary_writer
+ * @brief       The internal class binary_writer appends the bytes to a fixed buffer and
+ *              remembers whether the buffer was too small.
+ */
+class binary_writer
+{
+public:
+    explicit binary_writer(std::span<std::byte> buffer) noexcept
+        : m_buffer { buffer }
+    {
+    }
+
+    void write(const void* data, std::size_t size) noexcept
+    {
+        if (m_failed || m_buffer.size() - m_position < size)
+        {
+            m_failed = true;
+            return;
+        }
+        if (size != 0)
+        {
+            std::memcpy(m_buffer.data() + m_position, data, size);
+        }
+        m_position += size;
+    }
+
+    /**
+     * The number of the written bytes, 0 if the buffer was too small.
+     */
+    [[nodiscard]] std::size_t result() const noexcept
+    {
+        return m_failed ? 0 : m_position;
+    }
+
+private:
+    std::span<std::byte> m_buffer;
+    std::size_t m_position = 0;
+    bool m_failed = false;
+}; // class binary_writer
+
+/**
+ * @internal
+ * @class       binary_reader
+ * @brief       The internal class binary_reader consumes the bytes of a buffer and remembers
+ *              whether the buffer was too short.
+ */
+class binary_reader
+{
+public:
+    explicit binary_reader(std::span<const std::byte> buffer) noexcept
+        : m_buffer { buffer }
+    {
+    }
+
+    bool read(void* data, std::size_t size) noexcept
+    {
+        if (!can_read(size))
+        {
+            m_failed = true;
+            return false;
+        }
+        if (size != 0)
+        {
+            std::memcpy(data, m_buffer.data() + m_position, size);
+        }
+        m_position += size;
+        return true;
+    }
+
+    /**
+     * Whether the given number of bytes is left, used to reject the corrupted lengths before
+     * the allocation.
+     */
+    [[nodiscard]] bool can_read(std::size_t size) const noexcept
+    {
+        return !m_failed && m_buffer.size() - m_position >= size;
+    }
+
+    /**
+     * Marks the buffer corrupted.
+     */
+    bool fail() noexcept
+    {
+        m_failed = true;
+        return false;
+    }
+
+    /**
+     * The number of the consumed bytes, 0 if the buffer was too short.
+     */
+    [[nodiscard]] std::size_t result() const noexcept
+    {
+        return m_failed ? 0 : m_position;
+    }
+
+private:
+    std::span<const std::byte> m_buffer;
+    std::size_t m_position = 0;
+    bool m_failed = false;
+}; // class binary_reader
+
+/**
+ * @internal
+ * @brief       The binary format of a value. The trivially copyable values are stored as their
+ *              bytes, the strings and vectors as the 64-bit element count and the elements.
+ */
+template <typename T>
+struct binary_format;
+
+template <typename T>
+concept is_binary_serializable = requires { binary_format<T>::size; };
+
+template <typename T>
+    requires(std::is_trivially_copyable_v<T>)
+struct binary_format<T>
+{
+    static std::size_t size(const T&) noexcept
+    {
+        return sizeof(T);
+    }
+
+    static void write(binary_writer& writer, const T& value) noexcept
+    {
+        writer.write(&value, sizeof(T));
+    }
+
+    static bool read(binary_reader& reader, T& value) noexcept
+    {
+        return reader.read(&value, sizeof(T));
+    }
+};
+
+/**
+ * @internal
+ * @brief       The common format of the sequences, the trivially copyable elements are copied
+ *              at once.
+ */
+template <typename TSequence, typename TElement>
+struct sequence_binary_format
+{
+    static std::size_t size(const TSequence& value) noexcept
+    {
+        if constexpr (std::is_trivially_copyable_v<TElement>)
+        {
+            return sizeof(std::uint64_t) + value.size() * sizeof(TElement);
+        }
+        else
+        {
+            std::size_t result = sizeof(std::uint64_t);
+            for (const auto& element : value)
+            {
+                result += binary_format<TElement>::size(element);
+            }
+            return result;
+        }
+    }
+
+    static void write(binary_writer& writer, const TSequence& value) noexcept
+    {
+        const auto count = static_cast<std::uint64_t>(value.size());
+        writer.write(&count, sizeof(count));
+        if constexpr (std::is_trivially_copyable_v<TElement>)
+        {
+            writer.write(value.data(), value.size() * sizeof(TElement));
+        }
+        else
+        {
+            for (const auto& element : value)
+            {
+                binary_format<TElement>::write(writer, element);
+            }
+        }
+    }
+
+    static bool read(binary_reader& reader, TSequence& value)
+    {
+        std::uint64_t count = 0;
+        if (!reader.read(&count, sizeof(count)))
+        {
+            return false;
+        }
+        if constexpr (std::is_trivially_copyable_v<TElement>)
+        {
+            if (count > SIZE_MAX / sizeof(TElement) || !reader.can_read(count * sizeof(TElement)))
+            {
+                return reader.fail();
+            }
+            value.resize(static_cast<std::size_t>(count));
+            return reader.read(value.data(), value.size() * sizeof(TElement));
+        }
+        else
+        {
+            // Every element takes at least one byte, which bounds the corrupted counts.
+            if (!reader.can_read(static_cast<std::size_t>(std::min<std::uint64_t>(count,
+                                                                                  SIZE_MAX))))
+            {
+                return reader.fail();
+            }
+            value.resize(static_cast<std::size_t>(count));
+            for (auto& element : value)
+            {
+                if (!binary_format<TElement>::read(reader, element))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+};
+
+template <typename TChar, typename TTraits, typename TAllocator>
+    requires(is_binary_serializable<TChar>)
+struct binary_format<std::basic_string<TChar, TTraits, TAllocator>>
+    : sequence_binary_format<std::basic_string<TChar, TTraits, TAllocator>, TChar>
+{ };
+
+template <typename TElement, typename TAllocator>
+    requires(is_binary_serializable<TElement> && !std::is_same_v<TElement, bool>)
+struct binary_format<std::vector<TElement, TAllocator>>
+    : sequence_binary_format<std::vector<TElement, TAllocator>, TElement>
+{ };
+
+template <typename TOwner, typename TFunction, typename... TMembers>
+bool for_each_value(TOwner& owner, TFunction&& function, property_list<TMembers...>)
+{
+    static_assert((std::is_same_v<typename TMembers::storage_policy, plain> && ...),
+                  "The serialization supports only the properties with the plain storage "
+                  "policy.");
+    return (function(property_access::value(owner.*TMembers::pointer)) && ...);
+}
+
+template <typename... TMembers>
+constexpr bool are_trivially_copyable(property_list<TMembers...>) noexcept
+{
+    return (std::is_trivially_copyable_v<typename TMembers::value_type> && ...);
+}
+
+/**
+ * @internal
+ * @brief       The total size of the listed property values, it equals the size of the owner
+ *              only if the owner has no padding and no unlisted members.
+ */
+template <typename... TMembers>
+constexpr std::size_t values_size(property_list<TMembers...>) noexcept
+{
+    return (std::size_t { 0 } + ... + sizeof(typename TMembers::value_type));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Whether the owner is serialized as a single copy of its bytes. It is so when the owner and
+ * the values of all listed properties are trivially copyable, and the listed values fill the
+ * whole owner, so the copy writes no padding and no unlisted members.
+ */
+template <reflectable TOwner>
+inline constexpr bool is_trivially_serializable =
+    std::is_trivially_copyable_v<TOwner> && impl::are_trivially_copyable(properties_of<TOwner> {})
+    && impl::values_size(properties_of<TOwner> {}) == sizeof(TOwner);
+
+/**
+ * Returns the number of bytes the serialization of the owner takes.
+ */
+template <reflectable TOwner>
+[[nodiscard]] std::size_t serialized_size(const TOwner& owner) noexcept
+{
+    if constexpr (is_trivially_serializable<TOwner>)
+    {
+        return sizeof(TOwner);
+    }
+    else
+    {
+        std::size_t result = 0;
+        impl::for_each_value(owner, [&]<typename T>(const T& value)
+        {
+            result += impl::binary_format<T>::size(value);
+            return true;
+        }, properties_of<TOwner> {});
+        return result;
+    }
+}
+
+/**
+ * Writes the listed properties of the owner, including the private ones, to the buffer. The
+ * trivially serializable owners are copied at once, the others field by field in the list order.
+ * The values are stored in the byte order of the machine.
+ *
+ * @param owner  The owner, all listed properties should have the plain storage policy.
+ * @param buffer The output buffer.
+ * @return The number of the written bytes, 0 if the buffer is too small.
+ */
+template <reflectable TOwner>
+std::size_t serialize(const TOwner& owner, std::span<std::byte> buffer) noexcept
+{
+    impl::binary_writer writer { buffer };
+    if constexpr (is_trivially_serializable<TOwner>)
+    {
+        writer.write(&owner, sizeof(TOwner));
+    }
+    else
+    {
+        impl::for_each_value(owner, [&]<typename T>(const T& value)
+        {
+            impl::binary_format<T>::write(writer, value);
+            return true;
+        }, properties_of<TOwner> {});
+    }
+    return writer.result();
+}
+
+/**
+ * Reads the listed properties of the owner from the buffer written by serialize.
+ *
+ * @param owner  The owner, the properties are left partially updated on failure.
+ * @param buffer The input buffer.
+ * @return The number of the consumed bytes, 0 if the buffer is too short or corrupted.
+ */
+template <reflectable TOwner>
+std::size_t deserialize(TOwner& owner, std::span<const std::byte> buffer)
+{
+    impl::binary_reader reader { buffer };
+    if constexpr (is_trivially_serializable<TOwner>)
+    {
+        reader.read(&owner, sizeof(TOwner));
+    }
+    else
+    {
+        impl::for_each_value(owner, [&]<typename T>(T& value)
+        {
+            return impl::binary_format<T>::read(reader, value);
+        }, properties_of<TOwner> {});
+    }
+    return reader.result();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace util
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // PROPERTY_PROPERTY_SERIALIZATION_H
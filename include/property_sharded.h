@@ -0,0 +1,301 @@
+/**
+ * @file        property_sharded.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of the sharded storage policy of property class.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef PROPERTY_PROPERTY_SHARDED_H
+#define PROPERTY_PROPERTY_SHARDED_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+#include "property.h"
+#include "property_cache_aligned.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace util {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Store an arithmetic value as a set of per-thread counters on separate cache lines. Each thread
+ * adds to its own shard, a read sums all shards. Suits write-heavy statistics which are read
+ * rarely.
+ *
+ * @tparam TShardCount The number of shards, the threads are assigned to the shards round-robin.
+ */
+template <std::size_t TShardCount = 16>
+class sharded
+{
+    static_assert(TShardCount > 0, "The sharded storage policy requires at least one shard.");
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <std::size_t TShardCount>
+inline constexpr bool enable_storage_policy<sharded<TShardCount>> = true;
+
+/**
+ * @internal
+ * @brief       Returns the sequential number of the calling thread, assigned on the first call.
+ */
+inline std::size_t this_thread_shard() noexcept
+{
+    static std::atomic<std::size_t> next_shard { 0 };
+    thread_local const std::size_t shard = next_shard.fetch_add(1, std::memory_order_relaxed);
+    return shard;
+}
+
+/**
+ * @internal
+ * @class       sharded_storage
+ * @brief       The internal class sharded_storage keeps the value as the sum of the cache line
+ *              padded atomic shards.
+ *
+ * @tparam T    The value type.
+ * @tparam TShardCount The number of shards.
+ */
+template <typename T, std::size_t TShardCount>
+class sharded_storage
+{
+    static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>,
+                  "The sharded storage policy requires an arithmetic value type.");
+
+    struct alignas(destructive_interference_size) shard
+    {
+        std::atomic<T> value { T {} };
+    };
+
+protected:
+    explicit sharded_storage(T value) noexcept
+    {
+        m_shards[0].value.store(value, std::memory_order_relaxed);
+    }
+
+    sharded_storage(const sharded_storage& other) noexcept
+        : sharded_storage { other.load() }
+    {
+    }
+
+    sharded_storage& operator=(const sharded_storage& other) noexcept
+    {
+        reset(other.load());
+        return *this;
+    }
+
+    ~sharded_storage() = default;
+
+    /**
+     * Sums the shards. The concurrent additions may or may not be included.
+     */
+    [[nodiscard]] T load() const noexcept
+    {
+        T sum {};
+        for (const auto& shard : m_shards)
+        {
+            sum += shard.value.load(std::memory_order_relaxed);
+        }
+        return sum;
+    }
+
+    void add(T value) noexcept
+    {
+        m_shards[this_thread_shard() % TShardCount].value.fetch_add(value,
+                                                                    std::memory_order_relaxed);
+    }
+
+    /**
+     * Replaces the value, the additions concurrent with the reset may be lost.
+     */
+    void reset(T value) noexcept
+    {
+        m_shards[0].value.store(value, std::memory_order_relaxed);
+        for (std::size_t i = 1; i < TShardCount; ++i)
+        {
+            m_shards[i].value.store(T {}, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    /*
+     * The per-thread parts of the value.
+     */
+    std::array<shard, TShardCount> m_shards;
+}; // class sharded_storage
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @class          property
+ * @brief          The property specialization which stores the value as per-thread shards.
+ * @details        The reads (load and the conversion operator) sum the shards and follow the
+ *                 get part of the access policy. The writes (add, the compound assignments,
+ *                 increments, decrements, reset and the assignment) follow the set part. The
+ *                 additions never contend unless several threads share a shard.
+ * @example        struct server
+ *                 {
+ *                     util::property<server, long, util::public_get, util::sharded<64>> hits;
+ *                     void on_request() { ++hits; }
+ *                 };
+ *                 long total = s.hits.load();
+ * @tparam TOwner  is the type of owner, which should have all accesses.
+ * @tparam TValue  is the type of property value, should be arithmetic.
+ * @tparam TAccessPolicy is the access policy for the property.
+ * @tparam TShardCount is the number of shards.
+ */
+template <typename TOwner, typename TValue, typename TAccessPolicy, std::size_t TShardCount>
+class property<TOwner, TValue, TAccessPolicy, sharded<TShardCount>>
+    : private impl::sharded_storage<TValue, TShardCount>
+{
+    friend TOwner;
+
+    /*
+     * The wrapping storage policies (e.g. cache_aligned) forward to the wrapped property.
+     */
+    template <typename, typename, typename TOtherAccessPolicy, typename TOtherStoragePolicy>
+        requires(impl::is_access_policy<TOtherAccessPolicy>
+                 && impl::is_storage_policy<TOtherStoragePolicy>)
+    friend class property;
+
+    static constexpr bool is_public_get = impl::is_public_get<TAccessPolicy>;
+    static constexpr bool is_public_set = impl::is_public_set<TAccessPolicy>;
+    using storage_type = impl::sharded_storage<TValue, TShardCount>;
+
+public:
+    property(TValue value = TValue {}) noexcept
+        : storage_type { value }
+    {
+    }
+
+    ~property() = default;
+    property(const property&) = default;
+    property& operator=(const property&) = default;
+
+public:
+    [[nodiscard]] TValue load() const noexcept requires(is_public_get)
+    {
+        return storage_type::load();
+    }
+
+    operator TValue() const noexcept requires(is_public_get)
+    {
+        return storage_type::load();
+    }
+
+private:
+    [[nodiscard]] TValue load() const noexcept requires(!is_public_get)
+    {
+        return storage_type::load();
+    }
+
+    operator TValue() const noexcept requires(!is_public_get)
+    {
+        return storage_type::load();
+    }
+
+public:
+    void add(TValue value) noexcept requires(is_public_set)
+    {
+        storage_type::add(value);
+    }
+
+    void operator+=(TValue value) noexcept requires(is_public_set)
+    {
+        storage_type::add(value);
+    }
+
+    void operator-=(TValue value) noexcept requires(is_public_set)
+    {
+        storage_type::add(-value);
+    }
+
+    void operator++() noexcept requires(is_public_set)
+    {
+        storage_type::add(1);
+    }
+
+    void operator++(int) noexcept requires(is_public_set)
+    {
+        storage_type::add(1);
+    }
+
+    void operator--() noexcept requires(is_public_set)
+    {
+        storage_type::add(-1);
+    }
+
+    void operator--(int) noexcept requires(is_public_set)
+    {
+        storage_type::add(-1);
+    }
+
+    void reset(TValue value = TValue {}) noexcept requires(is_public_set)
+    {
+        storage_type::reset(value);
+    }
+
+    void operator=(TValue value) noexcept requires(is_public_set)
+    {
+        storage_type::reset(value);
+    }
+
+private:
+    void add(TValue value) noexcept requires(!is_public_set)
+    {
+        storage_type::add(value);
+    }
+
+    void operator+=(TValue value) noexcept requires(!is_public_set)
+    {
+        storage_type::add(value);
+    }
+
+    void operator-=(TValue value) noexcept requires(!is_public_set)
+    {
+        storage_type::add(-value);
+    }
+
+    void operator++() noexcept requires(!is_public_set)
+    {
+        storage_type::add(1);
+    }
+
+    void operator++(int) noexcept requires(!is_public_set)
+    {
+        storage_type::add(1);
+    }
+
+    void operator--() noexcept requires(!is_public_set)
+    {
+        storage_type::add(-1);
+    }
+
+    void operator--(int) noexcept requires(!is_public_set)
+    {
+        storage_type::add(-1);
+    }
+
+    void reset(TValue value = TValue {}) noexcept requires(!is_public_set)
+    {
+        storage_type::reset(value);
+    }
+
+    void operator=(TValue value) noexcept requires(!is_public_set)
+    {
+        storage_type::reset(value);
+    }
+}; // class property<TOwner, TValue, TAccessPolicy, sharded<TShardCount>>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace util
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // PROPERTY_PROPERTY_SHARDED_H
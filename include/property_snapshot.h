@@ -0,0 +1,663 @@
+/**
+ * @file        property_snapshot.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of the snapshot storage policy of property class.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef PROPERTY_PROPERTY_SNAPSHOT_H
+#define PROPERTY_PROPERTY_SNAPSHOT_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "property.h"
+#include "property_cache_aligned.h"
+
+/*
+ * On Linux the writers order the plain stores of the readers with the expedited membarrier,
+ * which runs a memory barrier on every processor running a thread of the process.
+ */
+#if defined(__linux__) && __has_include(<linux/membarrier.h>)
+#define PROPERTY_SNAPSHOT_MEMBARRIER
+#include <linux/membarrier.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace util {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Store the value as an immutable version, RCU style. The readers enter an epoch and read the
+ * current version with plain loads and stores, the writers publish a new version and free the
+ * replaced ones once no reader can see them.
+ */
+class snapshot
+{ };
+
+/**
+ * @class          read_guard
+ * @brief          The version of a snapshot property, read inside an epoch.
+ * @details        The version stays valid while the guard is alive. The guards should be short
+ *                 living, the versions replaced after the oldest active guard was created are
+ *                 not freed until it is destroyed.
+ * @tparam T       is the value type.
+ */
+template <typename T>
+class read_guard;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <>
+inline constexpr bool enable_storage_policy<snapshot> = true;
+
+/**
+ * @internal
+ * @brief       Registers the process for the expedited membarrier once.
+ *
+ * @return      true if the writers may use the membarrier as the heavy fence.
+ */
+inline bool is_membarrier_registered() noexcept
+{
+#if defined(PROPERTY_SNAPSHOT_MEMBARRIER)
+    static const bool registered =
+        syscall(__NR_membarrier, MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED, 0, 0) == 0;
+    return registered;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @internal
+ * @class       epoch_domain
+ * @brief       The internal class epoch_domain tracks the epochs of the active readers of all
+ *              snapshot properties and frees the replaced versions.
+ * @details     A reader thread owns a slot on its own cache line, taken on its first read. It
+ *              stores the current epoch to the slot when it enters the outermost read section,
+ *              and zero when it leaves. A writer retires the replaced version with the epoch
+ *              before its increment, and frees it once every active reader has entered in a
+ *              later epoch.
+ *
+ *              The store of the reader has to be visible to the writer before the reader loads
+ *              the version. Where the membarrier is available, the reader orders them only for
+ *              the compiler, and the writer runs the membarrier before it scans the slots, so
+ *              a read is an acquire load of the epoch and of the version and a relaxed store,
+ *              plain moves on x86, plus the access to the thread local state. The cost moves
+ *              to the writes: every collection is a system call interrupting the processors,
+ *              which run the threads of the process. Elsewhere, or if the registration fails,
+ *              the reader issues a full fence after the store instead.
+ *
+ *              The slots are allocated in blocks, which are added when all slots are taken,
+ *              so every reader has its own slot. The blocks are freed with the domain.
+ */
+class epoch_domain
+{
+    static constexpr std::size_t block_size = 64;
+
+public:
+    constexpr epoch_domain() noexcept = default;
+    epoch_domain(const epoch_domain&) = delete;
+    epoch_domain& operator=(const epoch_domain&) = delete;
+
+    /*
+     * The domain is destroyed after all threads, which may read, are joined.
+     */
+    ~epoch_domain()
+    {
+        for (const auto& version : m_retired)
+        {
+            version.destroy(version.value);
+        }
+        for (auto* block = m_head.next.load(std::memory_order_relaxed); block != nullptr;)
+        {
+            delete std::exchange(block, block->next.load(std::memory_order_relaxed));
+        }
+    }
+
+    static epoch_domain& instance() noexcept;
+
+    void enter() noexcept
+    {
+        auto& reader = this_thread_reader;
+        if (reader.depth++ != 0)
+        {
+            return;
+        }
+        if (reader.slot == nullptr)
+        {
+            attach(reader);
+        }
+        // The acquire pairs with the increment of the writer, the version replaced before it is
+        // not visible to the reader.
+        reader.slot->epoch.store(m_epoch.load(std::memory_order_acquire),
+                                 std::memory_order_relaxed);
+        if (reader.is_asymmetric)
+        {
+            std::atomic_signal_fence(std::memory_order_seq_cst);
+        }
+        else
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+    }
+
+    void leave() noexcept
+    {
+        auto& reader = this_thread_reader;
+        if (--reader.depth == 0)
+        {
+            reader.slot->epoch.store(0, std::memory_order_release);
+        }
+    }
+
+    /**
+     * Replaces the current version with the next one and collects the versions, which no
+     * reader can see.
+     *
+     * @param owner The storage of the version, for the diagnostics.
+     * @param current The current version.
+     * @param next The next version.
+     */
+    template <typename T>
+    void retire(const void* owner, std::atomic<const T*>& current, std::unique_ptr<const T> next)
+    {
+        {
+            std::lock_guard lock { m_mutex };
+            m_retired.reserve(m_retired.size() + 1);
+            const T* previous = current.exchange(next.release());
+            m_retired.push_back({ previous, owner, &destroy<T>, m_epoch.fetch_add(1) });
+        }
+        collect();
+    }
+
+    /**
+     * Frees the retired versions of all storages, which no reader can see.
+     */
+    void collect()
+    {
+        heavy_fence();
+        std::vector<retired_version> unreachable;
+        {
+            std::lock_guard lock { m_mutex };
+            const auto oldest_active = this->oldest_active();
+            const auto visible = std::stable_partition(m_retired.begin(), m_retired.end(),
+                                                       [&](const retired_version& version)
+            {
+                return version.epoch >= oldest_active;
+            });
+            unreachable.assign(visible, m_retired.end());
+            m_retired.erase(visible, m_retired.end());
+        }
+        // The versions are destroyed without the lock, their values may own snapshots too.
+        for (const auto& version : unreachable)
+        {
+            version.destroy(version.value);
+        }
+    }
+
+    /**
+     * Frees the retired versions of the destroyed storage, which no reader can reach.
+     */
+    void forget(const void* owner) noexcept
+    {
+        std::vector<retired_version> owned;
+        {
+            std::lock_guard lock { m_mutex };
+            const auto kept = std::stable_partition(m_retired.begin(), m_retired.end(),
+                                                    [&](const retired_version& version)
+            {
+                return version.owner != owner;
+            });
+            owned.assign(kept, m_retired.end());
+            m_retired.erase(kept, m_retired.end());
+        }
+        for (const auto& version : owned)
+        {
+            version.destroy(version.value);
+        }
+    }
+
+    [[nodiscard]] std::size_t retired_count(const void* owner) const
+    {
+        std::lock_guard lock { m_mutex };
+        return static_cast<std::size_t>(std::ranges::count(m_retired, owner,
+                                                           &retired_version::owner));
+    }
+
+private:
+    struct alignas(destructive_interference_size) slot
+    {
+        std::atomic<std::uint64_t> epoch { 0 };
+        std::atomic<bool> used { false };
+    };
+
+    struct slot_block
+    {
+        std::array<slot, block_size> slots;
+        std::atomic<slot_block*> next { nullptr };
+    };
+
+    /*
+     * The state of the reader thread, trivial and zero initialized, so its access needs no
+     * initialization check.
+     */
+    struct reader
+    {
+        struct slot* slot;
+        std::size_t depth;
+        bool is_asymmetric;
+    };
+
+    /*
+     * Frees the slot of the thread on its exit.
+     */
+    struct reader_exit
+    {
+        reader_exit() noexcept = default;
+        reader_exit(const reader_exit&) = delete;
+        reader_exit& operator=(const reader_exit&) = delete;
+
+        ~reader_exit()
+        {
+            auto& reader = this_thread_reader;
+            reader.slot->used.store(false, std::memory_order_release);
+            reader.slot = nullptr;
+        }
+    };
+
+    struct retired_version
+    {
+        const void* value;
+        const void* owner;
+        void (*destroy)(const void*) noexcept;
+        std::uint64_t epoch;
+    };
+
+    template <typename T>
+    static void destroy(const void* value) noexcept
+    {
+        delete static_cast<const T*>(value);
+    }
+
+    /*
+     * Takes a free slot for the thread, the slow path of its first read.
+     */
+    void attach(reader& reader) noexcept
+    {
+        reader.is_asymmetric = is_membarrier_registered();
+        for (auto* block = &m_head; reader.slot == nullptr;)
+        {
+            for (auto& candidate : block->slots)
+            {
+                bool expected = false;
+                if (candidate.used.compare_exchange_strong(expected, true))
+                {
+                    reader.slot = &candidate;
+                    break;
+                }
+            }
+            auto* next = block->next.load(std::memory_order_acquire);
+            if (reader.slot == nullptr && next == nullptr)
+            {
+                auto* added = new slot_block;
+                if (block->next.compare_exchange_strong(next, added))
+                {
+                    next = added;
+                }
+                else
+                {
+                    delete added;
+                }
+            }
+            block = next;
+        }
+        thread_local reader_exit exit;
+    }
+
+    /*
+     * Orders the stores of the readers before the following loads of the slots.
+     */
+    static void heavy_fence() noexcept
+    {
+#if defined(PROPERTY_SNAPSHOT_MEMBARRIER)
+        if (is_membarrier_registered())
+        {
+            syscall(__NR_membarrier, MEMBARRIER_CMD_PRIVATE_EXPEDITED, 0, 0);
+            return;
+        }
+#endif
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+
+    /**
+     * The versions retired in the epochs before the returned one are not visible to any
+     * reader.
+     */
+    [[nodiscard]] std::uint64_t oldest_active() const noexcept
+    {
+        auto result = m_epoch.load();
+        for (const auto* block = &m_head; block != nullptr;
+             block = block->next.load(std::memory_order_acquire))
+        {
+            for (const auto& slot : block->slots)
+            {
+                if (const auto epoch = slot.epoch.load(); epoch != 0)
+                {
+                    result = std::min(result, epoch);
+                }
+            }
+        }
+        return result;
+    }
+
+private:
+    static inline thread_local constinit reader this_thread_reader {};
+
+    std::atomic<std::uint64_t> m_epoch { 1 };
+    slot_block m_head;
+
+    /*
+     * The replaced versions of all storages with the epochs they were replaced in.
+     */
+    std::vector<retired_version> m_retired;
+    mutable std::mutex m_mutex;
+}; // class epoch_domain
+
+/**
+ * @internal
+ * @brief       The domain of all snapshot properties, constant initialized, so the readers reach
+ *              it without an initialization check.
+ */
+inline constinit epoch_domain global_epoch_domain;
+
+inline epoch_domain& epoch_domain::instance() noexcept
+{
+    return global_epoch_domain;
+}
+
+/**
+ * @internal
+ * @class       snapshot_storage
+ * @brief       The internal class snapshot_storage keeps the current immutable version of the
+ *              value, the replaced versions are kept by the epoch domain.
+ *
+ * @tparam T    The value type.
+ */
+template <typename T>
+class snapshot_storage
+{
+protected:
+    template <typename... TArgs>
+    explicit snapshot_storage(std::in_place_t, TArgs&&... args)
+        : m_current { new T(std::forward<TArgs>(args)...) }
+    {
+    }
+
+    snapshot_storage(const snapshot_storage& other)
+        : m_current { new T(*other.read()) }
+    {
+    }
+
+    snapshot_storage& operator=(const snapshot_storage& other)
+    {
+        if (this != &other)
+        {
+            store(T(*other.read()));
+        }
+        return *this;
+    }
+
+    /*
+     * The property is destroyed when no reader can reach it, so all versions are freed.
+     */
+    ~snapshot_storage()
+    {
+        delete m_current.load(std::memory_order_relaxed);
+        epoch_domain::instance().forget(this);
+    }
+
+    /**
+     * Returns the current version, the reads take no read-modify-write operations.
+     */
+    [[nodiscard]] read_guard<T> read() const noexcept
+    {
+        return read_guard<T> { m_current };
+    }
+
+    void store(T&& value)
+    {
+        auto next = std::make_unique<const T>(std::move(value));
+        std::lock_guard lock { m_writer_mutex };
+        epoch_domain::instance().retire(this, m_current, std::move(next));
+    }
+
+    /**
+     * Publishes the copy of the current version modified by the given function.
+     */
+    template <typename TFunction>
+    void update(TFunction&& function)
+    {
+        std::lock_guard lock { m_writer_mutex };
+        auto next = std::make_unique<T>(*m_current.load(std::memory_order_relaxed));
+        std::forward<TFunction>(function)(*next);
+        epoch_domain::instance().retire(this, m_current,
+                                        std::unique_ptr<const T> { std::move(next) });
+    }
+
+    /**
+     * The number of the replaced versions, which are not freed yet.
+     */
+    [[nodiscard]] std::size_t retired_count() const
+    {
+        return epoch_domain::instance().retired_count(this);
+    }
+
+private:
+    /*
+     * The current version.
+     */
+    std::atomic<const T*> m_current;
+
+    /*
+     * Serializes the writers.
+     */
+    mutable std::mutex m_writer_mutex;
+}; // class snapshot_storage
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+class read_guard
+{
+    template <typename>
+    friend class impl::snapshot_storage;
+
+public:
+    read_guard(const read_guard&) = delete;
+    read_guard& operator=(const read_guard&) = delete;
+
+    ~read_guard()
+    {
+        impl::epoch_domain::instance().leave();
+    }
+
+    [[nodiscard]] const T& get() const noexcept
+    {
+        return *m_value;
+    }
+
+    const T& operator*() const noexcept
+    {
+        return *m_value;
+    }
+
+    const T* operator->() const noexcept
+    {
+        return m_value;
+    }
+
+private:
+    explicit read_guard(const std::atomic<const T*>& current) noexcept
+        : m_value { enter(current) }
+    {
+    }
+
+    static const T* enter(const std::atomic<const T*>& current) noexcept
+    {
+        impl::epoch_domain::instance().enter();
+        return current.load(std::memory_order_acquire);
+    }
+
+private:
+    const T* m_value;
+}; // class read_guard
+
+/**
+ * Frees the replaced versions of all snapshot properties, which no reader can see. The writes
+ * collect too, so it is needed only to free the last replaced versions once the writes stop.
+ */
+inline void collect_snapshots()
+{
+    impl::epoch_domain::instance().collect();
+}
+
+/**
+ * @class          property
+ * @brief          The property specialization which stores immutable versions of the value.
+ * @details        The reads (get) follow the get part of the access policy. The writes (store,
+ *                 the assignment and update) follow the set part. The writes copy or move the
+ *                 whole value into a new version, so the policy suits large read-mostly values.
+ *                 get returns a read_guard, which keeps the version alive. The writes to any
+ *                 snapshot property, and collect_snapshots, free the replaced versions once no
+ *                 guard can see them. A read costs two loads and a store to the slot of the
+ *                 thread, the write pays for it with a membarrier system call where available.
+ * @example        struct router
+ *                 {
+ *                     util::property<router, table, util::public_get, util::snapshot> routes;
+ *                     void reload(table next) { routes = std::move(next); }
+ *                 };
+ *                 auto current = r.routes.get();
+ *                 int target = current->at("/index");
+ * @tparam TOwner  is the type of owner, which should have all accesses.
+ * @tparam TValue  is the type of property value.
+ * @tparam TAccessPolicy is the access policy for the property.
+ */
+template <typename TOwner, typename TValue, typename TAccessPolicy>
+class property<TOwner, TValue, TAccessPolicy, snapshot>
+    : private impl::snapshot_storage<TValue>
+{
+    friend TOwner;
+
+    /*
+     * The wrapping storage policies (e.g. cache_aligned) forward to the wrapped property.
+     */
+    template <typename, typename, typename TOtherAccessPolicy, typename TOtherStoragePolicy>
+        requires(impl::is_access_policy<TOtherAccessPolicy>
+                 && impl::is_storage_policy<TOtherStoragePolicy>)
+    friend class property;
+
+    static constexpr bool is_public_get = impl::is_public_get<TAccessPolicy>;
+    static constexpr bool is_public_set = impl::is_public_set<TAccessPolicy>;
+    using storage_type = impl::snapshot_storage<TValue>;
+
+public:
+    property()
+        requires(std::is_default_constructible_v<TValue>)
+        : storage_type { std::in_place }
+    {
+    }
+
+    property(TValue value)
+        : storage_type { std::in_place, std::move(value) }
+    {
+    }
+
+    template <typename... TArgs>
+        requires(std::is_constructible_v<TValue, TArgs...>)
+    explicit property(std::in_place_t, TArgs&&... args)
+        : storage_type { std::in_place, std::forward<TArgs>(args)... }
+    {
+    }
+
+    ~property() = default;
+    property(const property&) = default;
+    property& operator=(const property&) = default;
+
+public:
+    [[nodiscard]] read_guard<TValue> get() const noexcept requires(is_public_get)
+    {
+        return storage_type::read();
+    }
+
+private:
+    [[nodiscard]] read_guard<TValue> get() const noexcept requires(!is_public_get)
+    {
+        return storage_type::read();
+    }
+
+public:
+    /*
+     * The number of the replaced versions, which are not freed yet, for the diagnostics.
+     */
+    using storage_type::retired_count;
+
+public:
+    void store(TValue new_value) requires(is_public_set)
+    {
+        storage_type::store(std::move(new_value));
+    }
+
+    void operator=(TValue new_value) requires(is_public_set)
+    {
+        storage_type::store(std::move(new_value));
+    }
+
+    template <typename TFunction>
+        requires(is_public_set && std::is_invocable_v<TFunction, TValue&>)
+    void update(TFunction&& function)
+    {
+        storage_type::update(std::forward<TFunction>(function));
+    }
+
+private:
+    void store(TValue new_value) requires(!is_public_set)
+    {
+        storage_type::store(std::move(new_value));
+    }
+
+    void operator=(TValue new_value) requires(!is_public_set)
+    {
+        storage_type::store(std::move(new_value));
+    }
+
+    template <typename TFunction>
+        requires(!is_public_set && std::is_invocable_v<TFunction, TValue&>)
+    void update(TFunction&& function)
+    {
+        storage_type::update(std::forward<TFunction>(function));
+    }
+}; // class property<TOwner, TValue, TAccessPolicy, snapshot>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace util
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#undef PROPERTY_SNAPSHOT_MEMBARRIER
+
+#endif // PROPERTY_PROPERTY_SNAPSHOT_H
@@ -0,0 +1,575 @@
+/**
+ * @file        property_soa.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of the struct-of-arrays container of owners.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef PROPERTY_PROPERTY_SOA_H
+#define PROPERTY_PROPERTY_SOA_H
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "property.h"
+#include "property_reflection.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace util {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @class          property_ref
+ * @brief          The reference to a value stored outside of the owner, e.g. in a column of
+ *                 soa_vector, which keeps the access policy of the property.
+ * @tparam TOwner  is the type of owner, which should have all accesses.
+ * @tparam TValue  is the type of property value.
+ * @tparam TAccessPolicy is the access policy for the property.
+ */
+template <typename TOwner, typename TValue, typename TAccessPolicy>
+    requires(impl::is_access_policy<TAccessPolicy>)
+class property_ref
+{
+    friend TOwner;
+    static constexpr bool is_public_get = impl::is_public_get<TAccessPolicy>;
+    static constexpr bool is_public_set = impl::is_public_set<TAccessPolicy>;
+
+public:
+    explicit property_ref(TValue& value) noexcept
+        : m_value { &value }
+    {
+    }
+
+    /*
+     * The assignment of the reference assigns the referred value, as the assignment of the
+     * property does.
+     */
+    property_ref(const property_ref&) = default;
+
+    const property_ref& operator=(const property_ref& other) const requires(is_public_set)
+    {
+        *m_value = *other.m_value;
+        return *this;
+    }
+
+public:
+    operator TValue&() const requires(is_public_get && is_public_set)
+    {
+        return *m_value;
+    }
+
+    operator const TValue&() const requires(is_public_get && !is_public_set)
+    {
+        return *m_value;
+    }
+
+private:
+    operator TValue&() const requires(!is_public_get)
+    {
+        return *m_value;
+    }
+
+public:
+    TValue& operator=(const TValue& new_value) const requires(is_public_set)
+    {
+        return *m_value = new_value;
+    }
+
+    TValue& operator=(TValue&& new_value) const requires(is_public_set)
+    {
+        return *m_value = std::move(new_value);
+    }
+
+private:
+    TValue& operator=(const TValue& new_value) const requires(!is_public_set)
+    {
+        return *m_value = new_value;
+    }
+
+    TValue& operator=(TValue&& new_value) const requires(!is_public_set)
+    {
+        return *m_value = std::move(new_value);
+    }
+
+private:
+    /*
+     * The referred value.
+     */
+    TValue* m_value;
+}; // class property_ref
+
+/**
+ * @class          const_property_ref
+ * @brief          The read only reference to a value stored outside of the owner, which keeps the
+ *                 get access policy of the property.
+ * @tparam TOwner  is the type of owner, which should have all accesses.
+ * @tparam TValue  is the type of property value.
+ * @tparam TAccessPolicy is the access policy for the property.
+ */
+template <typename TOwner, typename TValue, typename TAccessPolicy>
+    requires(impl::is_access_policy<TAccessPolicy>)
+class const_property_ref
+{
+    friend TOwner;
+    static constexpr bool is_public_get = impl::is_public_get<TAccessPolicy>;
+
+public:
+    explicit const_property_ref(const TValue& value) noexcept
+        : m_value { &value }
+    {
+    }
+
+public:
+    operator const TValue&() const requires(is_public_get)
+    {
+        return *m_value;
+    }
+
+private:
+    operator const TValue&() const requires(!is_public_get)
+    {
+        return *m_value;
+    }
+
+private:
+    /*
+     * The referred value.
+     */
+    const TValue* m_value;
+}; // class const_property_ref
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @internal
+ * @class       soa_column
+ * @brief       The internal class soa_column is a growable contiguous array. Unlike
+ *              std::vector, it stores bool values as an array of bool.
+ *
+ * @tparam T    The value type, should be default constructible.
+ */
+template <typename T>
+class soa_column
+{
+public:
+    soa_column() = default;
+    soa_column(soa_column&&) noexcept = default;
+    soa_column& operator=(soa_column&&) noexcept = default;
+
+    soa_column(const soa_column& other)
+        : m_data { std::make_unique<T[]>(other.m_size) }
+        , m_size { other.m_size }
+        , m_capacity { other.m_size }
+    {
+        std::copy_n(other.m_data.get(), m_size, m_data.get());
+    }
+
+    soa_column& operator=(const soa_column& other)
+    {
+        if (this != &other)
+        {
+            *this = soa_column { other };
+        }
+        return *this;
+    }
+
+    [[nodiscard]] T* data() noexcept
+    {
+        return m_data.get();
+    }
+
+    [[nodiscard]] const T* data() const noexcept
+    {
+        return m_data.get();
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return m_size;
+    }
+
+    [[nodiscard]] T& operator[](std::size_t index) noexcept
+    {
+        return m_data[index];
+    }
+
+    [[nodiscard]] const T& operator[](std::size_t index) const noexcept
+    {
+        return m_data[index];
+    }
+
+    void reserve(std::size_t capacity)
+    {
+        if (capacity <= m_capacity)
+        {
+            return;
+        }
+        auto data = std::make_unique<T[]>(capacity);
+        if constexpr (std::is_nothrow_move_assignable_v<T>)
+        {
+            std::move(m_data.get(), m_data.get() + m_size, data.get());
+        }
+        else
+        {
+            // A throwing move would leave the elements moved from, the copy keeps them.
+            std::copy_n(m_data.get(), m_size, data.get());
+        }
+        m_data = std::move(data);
+        m_capacity = capacity;
+    }
+
+    void resize(std::size_t size)
+    {
+        reserve(size);
+        std::fill(m_data.get() + std::min(size, m_size), m_data.get() + std::max(size, m_size),
+                  T {});
+        m_size = size;
+    }
+
+    template <typename TArg>
+    void push_back(TArg&& value)
+    {
+        if (m_size == m_capacity)
+        {
+            reserve(std::max<std::size_t>(2 * m_capacity, 8));
+        }
+        m_data[m_size] = std::forward<TArg>(value);
+        ++m_size;
+    }
+
+    void pop_back() noexcept
+    {
+        m_data[--m_size] = T {};
+    }
+
+private:
+    /*
+     * The elements, the ones after the size are value initialized.
+     */
+    std::unique_ptr<T[]> m_data;
+    std::size_t m_size = 0;
+    std::size_t m_capacity = 0;
+}; // class soa_column
+
+template <typename TList>
+struct soa_columns;
+
+template <typename... TMembers>
+struct soa_columns<property_list<TMembers...>>
+{
+    using type = std::tuple<soa_column<typename TMembers::value_type>...>;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @class          soa_vector
+ * @brief          The sequence of owners, which stores every listed property as its own
+ *                 contiguous column.
+ * @details        The owner should list its properties (see property_reflection.h), all of them
+ *                 should have the plain storage policy and default constructible values. The
+ *                 rows are accessed through the proxy references, the columns through spans,
+ *                 both keep the access policies of the properties: the public_get columns are
+ *                 read only and the private_get_set ones are accessible only to the owner.
+ *                 The whole owners can be copied in and out by push_back, load and store.
+ * @example        soa_vector<particle> particles;
+ *                 particles.push_back(particle { ... });
+ *                 for (float& x : particles.column<"x">()) { x += 1.0f; }
+ *                 float y = particles[0].get<"y">();
+ * @tparam TOwner  is the type of owner.
+ */
+template <reflectable TOwner>
+class soa_vector
+{
+    friend TOwner;
+    using list_type = properties_of<TOwner>;
+
+    template <fixed_string TName>
+    static constexpr std::size_t column_index = index_of<TOwner, TName>;
+
+    template <fixed_string TName>
+        requires(column_index<TName> < property_count<TOwner>)
+    using member_type = member_at<TOwner, column_index<TName>>;
+
+    template <fixed_string TName>
+    using value_t = typename member_type<TName>::value_type;
+
+    template <fixed_string TName>
+    static constexpr bool is_public_get =
+        impl::is_public_get<typename member_type<TName>::access_policy>;
+
+    template <fixed_string TName>
+    static constexpr bool is_public_set =
+        impl::is_public_set<typename member_type<TName>::access_policy>;
+
+    template <typename TMember>
+    static constexpr bool is_plain_member =
+        std::is_same_v<typename TMember::storage_policy, plain>;
+
+    static_assert([]<typename... TMembers>(property_list<TMembers...>)
+                  { return (is_plain_member<TMembers> && ...); }(list_type {}),
+                  "The soa_vector supports only the properties with the plain storage policy.");
+
+public:
+    /**
+     * @class      reference
+     * @brief      The proxy reference to one owner in the container.
+     */
+    class reference
+    {
+    public:
+        reference(soa_vector& container, std::size_t index) noexcept
+            : m_container { &container }
+            , m_index { index }
+        {
+        }
+
+        /**
+         * Returns the reference to the property with the given name, which keeps the access
+         * policy of the property.
+         */
+        template <fixed_string TName>
+        [[nodiscard]] auto get() const noexcept
+        {
+            using member = member_type<TName>;
+            return property_ref<TOwner, typename member::value_type, typename member::access_policy>
+                { m_container->template raw_column<TName>()[m_index] };
+        }
+
+    private:
+        soa_vector* m_container;
+        std::size_t m_index;
+    }; // class reference
+
+    /**
+     * @class      const_reference
+     * @brief      The read only proxy reference to one owner in the container.
+     */
+    class const_reference
+    {
+    public:
+        const_reference(const soa_vector& container, std::size_t index) noexcept
+            : m_container { &container }
+            , m_index { index }
+        {
+        }
+
+        /**
+         * Returns the read only reference to the property with the given name, which keeps the
+         * get access policy of the property.
+         */
+        template <fixed_string TName>
+        [[nodiscard]] auto get() const noexcept
+        {
+            using member = member_type<TName>;
+            return const_property_ref<TOwner, typename member::value_type,
+                                      typename member::access_policy>
+                { m_container->template raw_column<TName>()[m_index] };
+        }
+
+    private:
+        const soa_vector* m_container;
+        std::size_t m_index;
+    }; // class const_reference
+
+public:
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return m_size;
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    void reserve(std::size_t capacity)
+    {
+        std::apply([&](auto&... columns) { (columns.reserve(capacity), ...); }, m_columns);
+    }
+
+    /**
+     * Resizes the container, the new owners have the value initialized properties.
+     */
+    void resize(std::size_t size)
+    {
+        std::apply([&](auto&... columns) { (columns.resize(size), ...); }, m_columns);
+        m_size = size;
+    }
+
+    void clear() noexcept
+    {
+        resize(0);
+    }
+
+    /**
+     * Appends the owner with the value initialized properties.
+     */
+    reference emplace_back()
+    {
+        resize(size() + 1);
+        return (*this)[size() - 1];
+    }
+
+    /**
+     * Appends the copy of the properties of the owner. If a copy throws, the values appended to
+     * the previous columns are removed, so the container is not changed.
+     */
+    void push_back(const TOwner& owner)
+    {
+        std::size_t appended = 0;
+        try
+        {
+            for_each_column([&]<typename TMember>(TMember, auto& column)
+            {
+                column.push_back(impl::property_access::value(owner.*TMember::pointer));
+                ++appended;
+            });
+        }
+        catch (...)
+        {
+            std::size_t index = 0;
+            for_each_column([&]<typename TMember>(TMember, auto& column)
+            {
+                if (index++ < appended)
+                {
+                    column.pop_back();
+                }
+            });
+            throw;
+        }
+        ++m_size;
+    }
+
+    void pop_back() noexcept
+    {
+        std::apply([](auto&... columns) { (columns.pop_back(), ...); }, m_columns);
+        --m_size;
+    }
+
+    [[nodiscard]] reference operator[](std::size_t index) noexcept
+    {
+        return reference { *this, index };
+    }
+
+    [[nodiscard]] const_reference operator[](std::size_t index) const noexcept
+    {
+        return const_reference { *this, index };
+    }
+
+    /**
+     * Returns the owner with the copies of the properties of the element.
+     */
+    [[nodiscard]] TOwner load(std::size_t index) const
+    {
+        TOwner owner;
+        for_each_column([&]<typename TMember>(TMember, const auto& column)
+        {
+            impl::property_access::value(owner.*TMember::pointer) = column[index];
+        });
+        return owner;
+    }
+
+    /**
+     * Replaces the properties of the element with the copies of the properties of the owner.
+     */
+    void store(std::size_t index, const TOwner& owner)
+    {
+        for_each_column([&]<typename TMember>(TMember, auto& column)
+        {
+            column[index] = impl::property_access::value(owner.*TMember::pointer);
+        });
+    }
+
+public:
+    template <fixed_string TName>
+        requires(is_public_get<TName> && is_public_set<TName>)
+    [[nodiscard]] std::span<value_t<TName>> column() noexcept
+    {
+        return { raw_column<TName>().data(), size() };
+    }
+
+    template <fixed_string TName>
+        requires(is_public_get<TName>)
+    [[nodiscard]] std::span<const value_t<TName>> column() const noexcept
+    {
+        return { raw_column<TName>().data(), size() };
+    }
+
+private:
+    template <fixed_string TName>
+        requires(!is_public_get<TName>)
+    [[nodiscard]] std::span<value_t<TName>> column() noexcept
+    {
+        return { raw_column<TName>().data(), size() };
+    }
+
+    template <fixed_string TName>
+        requires(!is_public_get<TName>)
+    [[nodiscard]] std::span<const value_t<TName>> column() const noexcept
+    {
+        return { raw_column<TName>().data(), size() };
+    }
+
+private:
+    template <fixed_string TName>
+    [[nodiscard]] auto& raw_column() noexcept
+    {
+        return std::get<column_index<TName>>(m_columns);
+    }
+
+    template <fixed_string TName>
+    [[nodiscard]] const auto& raw_column() const noexcept
+    {
+        return std::get<column_index<TName>>(m_columns);
+    }
+
+    template <typename TSelf, typename TFunction>
+    static void for_each_column(TSelf& self, TFunction& function)
+    {
+        [&]<typename... TMembers, std::size_t... TIndexes>(property_list<TMembers...>,
+                                                          std::index_sequence<TIndexes...>)
+        {
+            (function(TMembers {}, std::get<TIndexes>(self.m_columns)), ...);
+        }(list_type {}, std::make_index_sequence<list_type::size> {});
+    }
+
+    template <typename TFunction>
+    void for_each_column(TFunction&& function)
+    {
+        for_each_column(*this, function);
+    }
+
+    template <typename TFunction>
+    void for_each_column(TFunction&& function) const
+    {
+        for_each_column(*this, function);
+    }
+
+private:
+    /*
+     * The columns, one per listed property, in the list order.
+     */
+    typename impl::soa_columns<list_type>::type m_columns;
+
+    /*
+     * The number of owners, kept apart from the columns as the owner may list no properties.
+     */
+    std::size_t m_size = 0;
+}; // class soa_vector
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace util
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // PROPERTY_PROPERTY_SOA_H
@@ -0,0 +1,378 @@
+/**
+ * @file        property_tracked.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of the tracked storage policy of property class.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef PROPERTY_PROPERTY_TRACKED_H
+#define PROPERTY_PROPERTY_TRACKED_H
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "property.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace util {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Store the value as an ordinary data member and mark the bit TIndex of the owner dirty_set on
+ * every write.
+ *
+ * @tparam TIndex The index of the property in the dirty_set of the owner.
+ */
+template <std::size_t TIndex>
+class tracked
+{ };
+
+/**
+ * @class          dirty_set
+ * @brief          The compact set of the indexes of the tracked properties, which were written
+ *                 since the last clear.
+ * @details        The owner keeps one dirty_set and passes it to the constructors of the
+ *                 tracked properties. Copying the owner copies the dirty bits too.
+ * @tparam TSize   is the number of the tracked properties.
+ */
+template <std::size_t TSize>
+class dirty_set
+{
+    template <typename, typename, typename TAccessPolicy, typename TStoragePolicy>
+        requires(impl::is_access_policy<TAccessPolicy> && impl::is_storage_policy<TStoragePolicy>)
+    friend class property;
+
+    static constexpr std::size_t word_bits = 64;
+
+public:
+    [[nodiscard]] static constexpr std::size_t size() noexcept
+    {
+        return TSize;
+    }
+
+    [[nodiscard]] bool test(std::size_t index) const noexcept
+    {
+        return (m_words[index / word_bits] & mask(index)) != 0;
+    }
+
+    void set(std::size_t index) noexcept
+    {
+        m_words[index / word_bits] |= mask(index);
+    }
+
+    void reset(std::size_t index) noexcept
+    {
+        m_words[index / word_bits] &= ~mask(index);
+    }
+
+    void clear() noexcept
+    {
+        m_words.fill(0);
+    }
+
+    [[nodiscard]] bool any() const noexcept
+    {
+        for (const auto word : m_words)
+        {
+            if (word != 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    [[nodiscard]] std::size_t count() const noexcept
+    {
+        std::size_t result = 0;
+        for (const auto word : m_words)
+        {
+            result += static_cast<std::size_t>(std::popcount(word));
+        }
+        return result;
+    }
+
+    /**
+     * Calls the function for the index of every dirty property, in the ascending order. Only
+     * the words with the set bits are scanned.
+     *
+     * @param function The function, which takes the index.
+     */
+    template <typename TFunction>
+    void for_each(TFunction&& function) const
+    {
+        for (std::size_t i = 0; i < m_words.size(); ++i)
+        {
+            for (auto word = m_words[i]; word != 0; word &= word - 1)
+            {
+                function(i * word_bits + static_cast<std::size_t>(std::countr_zero(word)));
+            }
+        }
+    }
+
+    /**
+     * Calls the function for the index of every dirty property, and clears the set. The bits
+     * set by the function itself are kept.
+     *
+     * @param function The function, which takes the index.
+     */
+    template <typename TFunction>
+    void consume(TFunction&& function)
+    {
+        for (std::size_t i = 0; i < m_words.size(); ++i)
+        {
+            auto word = std::exchange(m_words[i], 0);
+            for (; word != 0; word &= word - 1)
+            {
+                function(i * word_bits + static_cast<std::size_t>(std::countr_zero(word)));
+            }
+        }
+    }
+
+private:
+    [[nodiscard]] static constexpr std::uint64_t mask(std::size_t index) noexcept
+    {
+        return std::uint64_t { 1 } << (index % word_bits);
+    }
+
+    /*
+     * The dirty bits, the bit i of the word i / 64 belongs to the property with index i.
+     */
+    std::array<std::uint64_t, (TSize + word_bits - 1) / word_bits> m_words {};
+}; // class dirty_set
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <std::size_t TIndex>
+inline constexpr bool enable_storage_policy<tracked<TIndex>> = true;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @class          property
+ * @brief          The property specialization which marks itself dirty in the owner on writes.
+ * @details        The assignments and the mutable conversion operator set the bit TIndex of the
+ *                 dirty_set passed to the constructor, the reads through get() do not. The
+ *                 property refers to the dirty_set by the offset, so the dirty_set should be a
+ *                 member of the same owner.
+ * @example        struct player
+ *                 {
+ *                     template <class T, std::size_t I>
+ *                     using property_t = util::property<player, T, util::public_get_set,
+ *                                                       util::tracked<I>>;
+ *                     util::dirty_set<2> dirty;
+ *                     property_t<int, 0> health { dirty, 100 };
+ *                     property_t<std::string, 1> name { dirty };
+ *                 };
+ *                 p.health = 90;
+ *                 p.dirty.consume([&](std::size_t index) { send(p, index); });
+ * @tparam TOwner  is the type of owner, which should have all accesses.
+ * @tparam TValue  is the type of property value.
+ * @tparam TAccessPolicy is the access policy for the property.
+ * @tparam TIndex  is the index of the property in the dirty_set.
+ */
+template <typename TOwner, typename TValue, typename TAccessPolicy, std::size_t TIndex>
+class property<TOwner, TValue, TAccessPolicy, tracked<TIndex>>
+    : private impl::data_storage<TValue>
+{
+    friend TOwner;
+
+    /*
+     * The wrapping storage policies (e.g. cache_aligned) forward to the wrapped property.
+     */
+    template <typename, typename, typename TOtherAccessPolicy, typename TOtherStoragePolicy>
+        requires(impl::is_access_policy<TOtherAccessPolicy>
+                 && impl::is_storage_policy<TOtherStoragePolicy>)
+    friend class property;
+
+    static constexpr bool is_public_get = impl::is_public_get<TAccessPolicy>;
+    static constexpr bool is_public_set = impl::is_public_set<TAccessPolicy>;
+    using storage_type = impl::data_storage<TValue>;
+
+    template <typename TOther>
+    static constexpr bool is_assignable_from =
+        !std::is_same_v<std::remove_cvref_t<TOther>, TValue>
+        && !std::is_same_v<std::remove_cvref_t<TOther>, property>
+        && std::is_assignable_v<TValue&, TOther>;
+
+public:
+    /*
+     * The index of the property in the dirty_set.
+     */
+    static constexpr std::size_t index = TIndex;
+
+    template <std::size_t TSize>
+    explicit property(dirty_set<TSize>& dirty)
+        noexcept(std::is_nothrow_default_constructible_v<TValue>)
+        requires(std::is_default_constructible_v<TValue>)
+        : storage_type { std::in_place }
+        , m_dirty_word { this, word_of(dirty) }
+    {
+    }
+
+    template <std::size_t TSize>
+    property(dirty_set<TSize>& dirty, TValue value)
+        noexcept(std::is_nothrow_move_constructible_v<TValue>)
+        requires(std::is_move_constructible_v<TValue>)
+        : storage_type { std::in_place, std::move(value) }
+        , m_dirty_word { this, word_of(dirty) }
+    {
+    }
+
+    /**
+     * Constructs the value in place from the given arguments.
+     *
+     * @param dirty The dirty_set of the owner.
+     * @param args  The arguments forwarded to the value constructor.
+     */
+    template <std::size_t TSize, typename... TArgs>
+        requires(std::is_constructible_v<TValue, TArgs...>)
+    property(dirty_set<TSize>& dirty, std::in_place_t, TArgs&&... args)
+        noexcept(std::is_nothrow_constructible_v<TValue, TArgs...>)
+        : storage_type { std::in_place, std::forward<TArgs>(args)... }
+        , m_dirty_word { this, word_of(dirty) }
+    {
+    }
+
+    ~property() = default;
+
+private:
+    /*
+     * The copy keeps the offset, which is valid only in the copy of the owner, so only the owner
+     * copies the property.
+     */
+    property(property&&) = default;
+    property(const property&) = default;
+
+public:
+    /*
+     * The assignment of the property replaces only the value and marks it dirty.
+     */
+    property& operator=(const property& other)
+    {
+        if (this != &other)
+        {
+            this->value() = other.value();
+        }
+        mark_dirty();
+        return *this;
+    }
+
+    property& operator=(property&& other) noexcept(std::is_nothrow_move_assignable_v<TValue>)
+    {
+        if (this != &other)
+        {
+            this->value() = std::move(other.value());
+        }
+        mark_dirty();
+        return *this;
+    }
+
+public:
+    /*
+     * Reading through the constant accessor does not mark the property dirty.
+     */
+    [[nodiscard]] const TValue& get() const noexcept requires(is_public_get)
+    {
+        return this->value();
+    }
+
+    operator TValue&() requires(is_public_get && is_public_set)
+    {
+        mark_dirty();
+        return this->value();
+    }
+
+    operator const TValue&() requires(is_public_get && !is_public_set)
+    {
+        return this->value();
+    }
+
+private:
+    [[nodiscard]] const TValue& get() const noexcept requires(!is_public_get)
+    {
+        return this->value();
+    }
+
+    operator TValue&() requires(!is_public_get)
+    {
+        mark_dirty();
+        return this->value();
+    }
+
+public:
+    TValue& operator=(const TValue& new_value) requires(is_public_set)
+    {
+        mark_dirty();
+        return this->value() = new_value;
+    }
+
+    TValue& operator=(TValue&& new_value) requires(is_public_set)
+    {
+        mark_dirty();
+        return this->value() = std::move(new_value);
+    }
+
+    template <typename TOther>
+        requires(is_public_set && is_assignable_from<TOther>)
+    TValue& operator=(TOther&& new_value)
+    {
+        mark_dirty();
+        return this->value() = std::forward<TOther>(new_value);
+    }
+
+private:
+    TValue& operator=(const TValue& new_value) requires(!is_public_set)
+    {
+        mark_dirty();
+        return this->value() = new_value;
+    }
+
+    TValue& operator=(TValue&& new_value) requires(!is_public_set)
+    {
+        mark_dirty();
+        return this->value() = std::move(new_value);
+    }
+
+    template <typename TOther>
+        requires(!is_public_set && is_assignable_from<TOther>)
+    TValue& operator=(TOther&& new_value)
+    {
+        mark_dirty();
+        return this->value() = std::forward<TOther>(new_value);
+    }
+
+private:
+    template <std::size_t TSize>
+    static const std::uint64_t& word_of(const dirty_set<TSize>& dirty) noexcept
+    {
+        static_assert(TIndex < TSize, "The index of the tracked property is out of the set.");
+        return dirty.m_words[TIndex / dirty_set<TSize>::word_bits];
+    }
+
+    void mark_dirty() noexcept
+    {
+        m_dirty_word.get(this) |= std::uint64_t { 1 } << (TIndex % 64);
+    }
+
+private:
+    /*
+     * The word of the owner dirty_set, which contains the bit of the property.
+     */
+    impl::owner_link<std::uint64_t> m_dirty_word;
+}; // class property<TOwner, TValue, TAccessPolicy, tracked<TIndex>>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace util
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // PROPERTY_PROPERTY_TRACKED_H
@@ -0,0 +1,731 @@
+/**
+ * @file        property_versioned.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of the multi-version transactions and the
+ *              versioned storage policy of property class.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef PROPERTY_PROPERTY_VERSIONED_H
+#define PROPERTY_PROPERTY_VERSIONED_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "property.h"
+#include "property_cache_aligned.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace util {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Store the committed versions of the value, the writes are made by transactions and the reads
+ * through read views.
+ */
+class versioned
+{ };
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <>
+inline constexpr bool enable_storage_policy<versioned> = true;
+
+/**
+ * @internal
+ * @brief       The committed version of a value, the versions form a chain from the newest to
+ *              the oldest one.
+ */
+template <typename T>
+struct version_node
+{
+    template <typename... TArgs>
+    explicit version_node(std::uint64_t commit_time, TArgs&&... args)
+        : value(std::forward<TArgs>(args)...)
+        , timestamp { commit_time }
+    {
+    }
+
+    const T value;
+    std::uint64_t timestamp;
+    std::atomic<version_node*> older { nullptr };
+};
+
+/**
+ * @internal
+ * @brief       The operations of the staged write of a property type, the transaction keeps the
+ *              staged writes of the different types behind this table.
+ */
+struct staged_write_ops
+{
+    bool (*conflicts)(const void* property, std::uint64_t timestamp) noexcept;
+    void (*install)(void* property, void* node, std::uint64_t timestamp) noexcept;
+    bool (*prune)(void* property, std::uint64_t oldest_read) noexcept;
+    void (*destroy)(void* node) noexcept;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @class          version_domain
+ * @brief          The commit clock, the writer lock and the reader slots shared by the versioned
+ *                 properties, which are updated together.
+ * @details        The commits are serialized by the writer mutex and numbered by the clock. A
+ *                 reader takes the clock value as its read time and publishes it in a free slot
+ *                 with CAS, the commits free the versions, which are older than the versions
+ *                 visible at the oldest published read time. The readers never block the
+ *                 writers and the writers never block the readers. When all slots are taken, the
+ *                 further readers register under a mutex and hold the versions visible at the
+ *                 time of the first of them, until all of them are released. The properties
+ *                 with the old versions are tracked by the domain, so the versions are freed by
+ *                 the later commits (or collect), even if the property is not written again.
+ *                 The domain should outlive its properties.
+ */
+class version_domain
+{
+    friend class read_view;
+    friend class transaction;
+
+    template <typename, typename, typename TAccessPolicy, typename TStoragePolicy>
+        requires(impl::is_access_policy<TAccessPolicy> && impl::is_storage_policy<TStoragePolicy>)
+    friend class property;
+
+public:
+    static constexpr std::size_t slot_count = 128;
+
+    version_domain() = default;
+    version_domain(const version_domain&) = delete;
+    version_domain& operator=(const version_domain&) = delete;
+
+    /**
+     * The commit time of the last transaction.
+     */
+    [[nodiscard]] std::uint64_t now() const noexcept
+    {
+        return m_clock.load();
+    }
+
+    /**
+     * Frees the versions, which are no longer visible to any reader. The commits do the same,
+     * this is for the time after the last commit, when the readers are released.
+     */
+    void collect()
+    {
+        std::lock_guard lock { m_writer };
+        collect(oldest_read());
+    }
+
+private:
+    /**
+     * Publishes the current time in a free slot, or registers the reader in the overflow when
+     * all slots are taken.
+     *
+     * @param read_time The published time.
+     * @return The index of the slot, slot_count for the overflow.
+     */
+    std::size_t acquire(std::uint64_t& read_time) noexcept
+    {
+        const auto start = std::hash<std::thread::id> {}(std::this_thread::get_id());
+        for (std::size_t i = 0; i != slot_count; ++i)
+        {
+            auto& slot = m_slots[(start + i) % slot_count].time;
+            std::uint64_t expected = 0;
+            auto time = m_clock.load();
+            if (!slot.compare_exchange_strong(expected, time + 1))
+            {
+                continue;
+            }
+            // A commit, which has not seen the slot, may have freed the versions visible at the
+            // time, the time is valid once the clock has not moved past it.
+            for (auto current = m_clock.load(); current != time; current = m_clock.load())
+            {
+                time = current;
+                slot.store(time + 1);
+            }
+            read_time = time;
+            return (start + i) % slot_count;
+        }
+
+        // The commit stores the clock before it takes the mutex in oldest_read, so the time read
+        // under the mutex is either seen by the commit or not older than its clock.
+        std::lock_guard lock { m_overflow_mutex };
+        read_time = m_clock.load();
+        if (m_overflow_readers++ == 0)
+        {
+            m_overflow_time = read_time;
+        }
+        return slot_count;
+    }
+
+    void release(std::size_t slot) noexcept
+    {
+        if (slot == slot_count)
+        {
+            std::lock_guard lock { m_overflow_mutex };
+            --m_overflow_readers;
+            return;
+        }
+        m_slots[slot].time.store(0, std::memory_order_release);
+    }
+
+    /**
+     * The oldest time, which a reader may still read at.
+     */
+    [[nodiscard]] std::uint64_t oldest_read() noexcept
+    {
+        auto result = m_clock.load();
+        for (const auto& slot : m_slots)
+        {
+            if (const auto time = slot.time.load(); time != 0)
+            {
+                result = std::min(result, time - 1);
+            }
+        }
+        std::lock_guard lock { m_overflow_mutex };
+        if (m_overflow_readers != 0)
+        {
+            result = std::min(result, m_overflow_time);
+        }
+        return result;
+    }
+
+    /**
+     * Prunes the tracked properties, drops the ones left with a single version. Called under
+     * the writer mutex.
+     */
+    void collect(std::uint64_t oldest_read) noexcept
+    {
+        std::erase_if(m_pruned, [oldest_read](const auto& entry)
+        {
+            return !entry.ops->prune(entry.property, oldest_read);
+        });
+    }
+
+    /**
+     * Stops tracking the destroyed property.
+     */
+    void forget(const void* property) noexcept
+    {
+        std::lock_guard lock { m_writer };
+        std::erase_if(m_pruned, [property](const auto& entry)
+        {
+            return entry.property == property;
+        });
+    }
+
+private:
+    /*
+     * The reader slot, holds the read time plus one, zero if the slot is free.
+     */
+    struct alignas(impl::destructive_interference_size) slot
+    {
+        std::atomic<std::uint64_t> time { 0 };
+    };
+
+    /*
+     * The property, which keeps the versions older than the latest one.
+     */
+    struct pruned_property
+    {
+        void* property;
+        const impl::staged_write_ops* ops;
+    };
+
+    std::atomic<std::uint64_t> m_clock { 0 };
+    std::mutex m_writer;
+    std::array<slot, slot_count> m_slots;
+
+    /*
+     * The properties with the old versions, guarded by the writer mutex.
+     */
+    std::vector<pruned_property> m_pruned;
+
+    /*
+     * The readers, which have not found a free slot, and the read time of the first of them.
+     */
+    std::mutex m_overflow_mutex;
+    std::size_t m_overflow_readers = 0;
+    std::uint64_t m_overflow_time = 0;
+}; // class version_domain
+
+/**
+ * @class          read_view
+ * @brief          The consistent snapshot of all versioned properties of the domain.
+ * @details        The view sees exactly the transactions committed before its creation, the
+ *                 values read through it stay valid until its destruction. The view takes one
+ *                 reader slot of the domain.
+ */
+class read_view
+{
+    friend class transaction;
+
+public:
+    explicit read_view(version_domain& domain) noexcept
+        : m_domain { &domain }
+        , m_slot { domain.acquire(m_time) }
+    {
+    }
+
+    read_view(const read_view&) = delete;
+    read_view& operator=(const read_view&) = delete;
+
+    ~read_view()
+    {
+        m_domain->release(m_slot);
+    }
+
+    /**
+     * The commit time of the last transaction visible in the view.
+     */
+    [[nodiscard]] std::uint64_t time() const noexcept
+    {
+        return m_time;
+    }
+
+    [[nodiscard]] version_domain& domain() const noexcept
+    {
+        return *m_domain;
+    }
+
+private:
+    /**
+     * Moves the view to the later time, the versions visible at the earlier one may be freed.
+     */
+    void advance(std::uint64_t time) noexcept
+    {
+        m_time = time;
+        // The overflow readers are held at the time of the first one.
+        if (m_slot != version_domain::slot_count)
+        {
+            m_domain->m_slots[m_slot].time.store(time + 1);
+        }
+    }
+
+private:
+    version_domain* m_domain;
+    std::uint64_t m_time = 0;
+    std::size_t m_slot;
+}; // class read_view
+
+/**
+ * @class          transaction
+ * @brief          The set of the staged writes of the versioned properties, possibly of several
+ *                 owners, which are committed at once.
+ * @details        The transaction reads through its own view, and sees its own staged writes.
+ *                 commit installs all writes under the writer mutex with one new commit time,
+ *                 so a reader sees either all or none of them. The properties read or written
+ *                 through the transaction are validated at commit: if another transaction has
+ *                 committed a write of any of them after the view of this one, commit fails
+ *                 and discards the writes (the first committer wins). So the transactions are
+ *                 serializable, the decisions made on the read values (e.g. two withdrawals
+ *                 checking the sum of two balances) cannot skew. After the commit the
+ *                 transaction reads the state right after it. The uncommitted writes are
+ *                 discarded by the destructor. The transaction is used by one thread.
+ * @example        util::transaction tx { domain };
+ *                 item.price.set(tx, 9.5);
+ *                 item.quantity.set(tx, item.quantity.get(tx) - 1);
+ *                 if (!tx.commit()) { retry(); }
+ */
+class transaction
+{
+    template <typename, typename, typename TAccessPolicy, typename TStoragePolicy>
+        requires(impl::is_access_policy<TAccessPolicy> && impl::is_storage_policy<TStoragePolicy>)
+    friend class property;
+
+public:
+    explicit transaction(version_domain& domain) noexcept
+        : m_view { domain }
+    {
+    }
+
+    transaction(const transaction&) = delete;
+    transaction& operator=(const transaction&) = delete;
+
+    ~transaction()
+    {
+        discard();
+    }
+
+    [[nodiscard]] const read_view& view() const noexcept
+    {
+        return m_view;
+    }
+
+    /**
+     * Installs the staged writes atomically.
+     *
+     * @return Whether the writes are committed, false if a read or written property was
+     *         committed by another transaction after the view of this one.
+     */
+    bool commit()
+    {
+        auto& domain = m_view.domain();
+        {
+            std::lock_guard lock { domain.m_writer };
+            const auto conflicts = [this](const auto& access)
+            {
+                return access.ops->conflicts(access.property, m_view.time());
+            };
+            if (std::ranges::any_of(m_reads, conflicts) || std::ranges::any_of(m_writes, conflicts))
+            {
+                discard();
+                return false;
+            }
+
+            // Nothing throws after the first install.
+            using pruned_property = version_domain::pruned_property;
+            auto& pruned = domain.m_pruned;
+            pruned.reserve(pruned.size() + m_writes.size());
+            const auto time = domain.m_clock.load() + 1;
+            for (const auto& write : m_writes)
+            {
+                write.ops->install(write.property, write.node, time);
+                pruned.push_back({ write.property, write.ops });
+            }
+            domain.m_clock.store(time);
+            std::ranges::sort(pruned, std::less {}, &pruned_property::property);
+            const auto duplicates =
+                std::ranges::unique(pruned, std::equal_to {}, &pruned_property::property);
+            pruned.erase(duplicates.begin(), duplicates.end());
+
+            // The transaction reads at its own commit from now on.
+            m_view.advance(time);
+            domain.collect(domain.oldest_read());
+        }
+        m_writes.clear();
+        m_reads.clear();
+        return true;
+    }
+
+    /**
+     * Discards the staged writes and the tracked reads.
+     */
+    void discard() noexcept
+    {
+        for (const auto& write : m_writes)
+        {
+            write.ops->destroy(write.node);
+        }
+        m_writes.clear();
+        m_reads.clear();
+    }
+
+    /**
+     * The number of the staged writes.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return m_writes.size();
+    }
+
+private:
+    struct staged_write
+    {
+        void* property;
+        void* node;
+        const impl::staged_write_ops* ops;
+    };
+
+    /**
+     * Stages the new version of the property, replaces the earlier staged one.
+     */
+    void stage(void* property, void* node, const impl::staged_write_ops& ops)
+    {
+        for (auto& write : m_writes)
+        {
+            if (write.property == property)
+            {
+                ops.destroy(std::exchange(write.node, node));
+                return;
+            }
+        }
+        try
+        {
+            m_writes.push_back({ property, node, &ops });
+        }
+        catch (...)
+        {
+            ops.destroy(node);
+            throw;
+        }
+    }
+
+    [[nodiscard]] const void* find(const void* property) const noexcept
+    {
+        for (const auto& write : m_writes)
+        {
+            if (write.property == property)
+            {
+                return write.node;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * Tracks the committed version read through the transaction, for the validation at commit.
+     */
+    void track(const void* property, const impl::staged_write_ops& ops) const
+    {
+        if (m_reads.empty() || m_reads.back().property != property)
+        {
+            m_reads.push_back({ property, &ops });
+        }
+    }
+
+private:
+    struct tracked_read
+    {
+        const void* property;
+        const impl::staged_write_ops* ops;
+    };
+
+    read_view m_view;
+    std::vector<staged_write> m_writes;
+
+    /*
+     * The reads do not change the transaction, but are validated by its commit.
+     */
+    mutable std::vector<tracked_read> m_reads;
+}; // class transaction
+
+/**
+ * @class          property
+ * @brief          The property specialization which keeps the committed versions of the value.
+ * @details        The value is changed only by the transactions, the reads go through a read
+ *                 view (or the view of a transaction) and return the version committed last
+ *                 before the view. The reads take no locks and follow the get part of the access
+ *                 policy, set follows the set part. The reads through a transaction are tracked
+ *                 for its validation. The property is not copyable, the versions are freed by
+ *                 the commits, collect of the domain and the destructor.
+ * @example        struct item
+ *                 {
+ *                     template <class T>
+ *                     using property_t = util::property<item, T, util::public_get_set,
+ *                                                       util::versioned>;
+ *                     property_t<double> price;
+ *                     property_t<int> quantity { 10 };
+ *                 };
+ *                 util::read_view view { domain };
+ *                 double total = item.price.get(view) * item.quantity.get(view);
+ * @tparam TOwner  is the type of owner, which should have all accesses.
+ * @tparam TValue  is the type of property value.
+ * @tparam TAccessPolicy is the access policy for the property.
+ */
+template <typename TOwner, typename TValue, typename TAccessPolicy>
+class property<TOwner, TValue, TAccessPolicy, versioned>
+{
+    friend TOwner;
+
+    /*
+     * The wrapping storage policies (e.g. cache_aligned) forward to the wrapped property.
+     */
+    template <typename, typename, typename TOtherAccessPolicy, typename TOtherStoragePolicy>
+        requires(impl::is_access_policy<TOtherAccessPolicy>
+                 && impl::is_storage_policy<TOtherStoragePolicy>)
+    friend class property;
+
+    static constexpr bool is_public_get = impl::is_public_get<TAccessPolicy>;
+    static constexpr bool is_public_set = impl::is_public_set<TAccessPolicy>;
+    using node_type = impl::version_node<TValue>;
+
+public:
+    property() requires(std::is_default_constructible_v<TValue>)
+        : m_head { new node_type { 0 } }
+    {
+    }
+
+    property(TValue value) requires(std::is_move_constructible_v<TValue>)
+        : m_head { new node_type { 0, std::move(value) } }
+    {
+    }
+
+    /**
+     * Constructs the initial version in place from the given arguments.
+     */
+    template <typename... TArgs>
+        requires(std::is_constructible_v<TValue, TArgs...>)
+    explicit property(std::in_place_t, TArgs&&... args)
+        : m_head { new node_type { 0, std::forward<TArgs>(args)... } }
+    {
+    }
+
+    property(const property&) = delete;
+    property& operator=(const property&) = delete;
+
+    ~property()
+    {
+        if (auto* domain = m_domain.load(std::memory_order_relaxed))
+        {
+            domain->forget(this);
+        }
+        for (auto* node = m_head.load(std::memory_order_relaxed); node != nullptr;)
+        {
+            delete std::exchange(node, node->older.load(std::memory_order_relaxed));
+        }
+    }
+
+public:
+    [[nodiscard]] const TValue& get(const read_view& view) const noexcept requires(is_public_get)
+    {
+        return visible(view.time()).value;
+    }
+
+    [[nodiscard]] const TValue& get(const transaction& tx) const requires(is_public_get)
+    {
+        return read(tx);
+    }
+
+private:
+    [[nodiscard]] const TValue& get(const read_view& view) const noexcept requires(!is_public_get)
+    {
+        return visible(view.time()).value;
+    }
+
+    [[nodiscard]] const TValue& get(const transaction& tx) const requires(!is_public_get)
+    {
+        return read(tx);
+    }
+
+public:
+    /**
+     * Stages the new value in the transaction, it is visible to the others after the commit.
+     */
+    template <typename... TArgs>
+        requires(is_public_set && std::is_constructible_v<TValue, TArgs...>)
+    void set(transaction& tx, TArgs&&... args)
+    {
+        stage(tx, std::forward<TArgs>(args)...);
+    }
+
+private:
+    template <typename... TArgs>
+        requires(!is_public_set && std::is_constructible_v<TValue, TArgs...>)
+    void set(transaction& tx, TArgs&&... args)
+    {
+        stage(tx, std::forward<TArgs>(args)...);
+    }
+
+public:
+    /**
+     * The number of the stored versions, the versions still visible to the active readers and
+     * the latest one are kept.
+     */
+    [[nodiscard]] std::size_t version_count() const noexcept
+    {
+        std::size_t result = 0;
+        for (auto* node = m_head.load(std::memory_order_acquire); node != nullptr;
+             node = node->older.load(std::memory_order_acquire))
+        {
+            ++result;
+        }
+        return result;
+    }
+
+private:
+    /**
+     * The newest version committed not later than the time.
+     */
+    [[nodiscard]] const node_type& visible(std::uint64_t time) const noexcept
+    {
+        auto* node = m_head.load(std::memory_order_acquire);
+        while (node->timestamp > time)
+        {
+            node = node->older.load(std::memory_order_acquire);
+        }
+        return *node;
+    }
+
+    [[nodiscard]] const TValue& read(const transaction& tx) const
+    {
+        if (const auto* node = tx.find(this))
+        {
+            return static_cast<const node_type*>(node)->value;
+        }
+        tx.track(this, ops);
+        return visible(tx.view().time()).value;
+    }
+
+    template <typename... TArgs>
+    void stage(transaction& tx, TArgs&&... args)
+    {
+        m_domain.store(&tx.view().domain(), std::memory_order_relaxed);
+        tx.stage(this, new node_type { 0, std::forward<TArgs>(args)... }, ops);
+    }
+
+    /*
+     * The staged write operations, called by the transaction under the writer mutex.
+     */
+    static bool conflicts(const void* self, std::uint64_t time) noexcept
+    {
+        return static_cast<const property*>(self)->m_head.load()->timestamp > time;
+    }
+
+    static void install(void* self, void* new_node, std::uint64_t time) noexcept
+    {
+        auto& head = static_cast<property*>(self)->m_head;
+        auto* node = static_cast<node_type*>(new_node);
+        node->timestamp = time;
+        node->older.store(head.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        head.store(node, std::memory_order_release);
+    }
+
+    /**
+     * Frees the versions older than the one visible at the oldest read time, no reader reaches
+     * them.
+     *
+     * @return Whether the older versions are left.
+     */
+    static bool prune(void* self, std::uint64_t oldest_read) noexcept
+    {
+        auto* head = static_cast<property*>(self)->m_head.load(std::memory_order_relaxed);
+        auto* node = head;
+        while (node->timestamp > oldest_read)
+        {
+            node = node->older.load(std::memory_order_relaxed);
+        }
+        for (auto* old = node->older.exchange(nullptr); old != nullptr;)
+        {
+            delete std::exchange(old, old->older.load(std::memory_order_relaxed));
+        }
+        return node != head;
+    }
+
+    static void destroy(void* node) noexcept
+    {
+        delete static_cast<node_type*>(node);
+    }
+
+    static constexpr impl::staged_write_ops ops { &conflicts, &install, &prune, &destroy };
+
+private:
+    /*
+     * The newest committed version.
+     */
+    std::atomic<node_type*> m_head;
+
+    /*
+     * The domain of the transactions writing the property, which tracks its old versions.
+     */
+    std::atomic<version_domain*> m_domain { nullptr };
+}; // class property<TOwner, TValue, TAccessPolicy, versioned>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace util
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // PROPERTY_PROPERTY_VERSIONED_H
@@ -0,0 +1,943 @@
+/**
+ * @file        property_view.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of the strided views of one property across the
+ *              containers of owners, and the reduction kernels over them.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef PROPERTY_PROPERTY_VIEW_H
+#define PROPERTY_PROPERTY_VIEW_H
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+/*
+ * The vector kernels are compiled with the target attributes of GCC and Clang on x86, and run
+ * after the processor check, so they do not need the -mavx2 or -mavx512f flags.
+ */
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define PROPERTY_VIEW_X86_KERNELS
+#pragma GCC diagnostic push
+// The AVX-512 reductions of GCC 12 read an undefined vector on purpose.
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#include <immintrin.h>
+#pragma GCC diagnostic pop
+#endif
+
+#include "property.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace util {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @class          property_view
+ * @brief          The read only random access view of one property across a contiguous range
+ *                 of owners, or of a contiguous array of values (e.g. a soa_vector column).
+ * @details        The view keeps the address of the first value and the distance between the
+ *                 values in bytes. When the distance is the size of the value, the view is
+ *                 contiguous and the reduction kernels use the vector instructions of the widest
+ *                 instruction set the processor runs (AVX-512 or AVX2 on x86), otherwise the
+ *                 unrolled scalar loops.
+ *                 The views of the properties can be created only for the public_get and
+ *                 public_get_set properties with the plain storage policy.
+ * @example        std::vector<particle> particles;
+ *                 util::property_view masses { particles, &particle::mass };
+ *                 double total = util::sum(masses);
+ * @tparam TValue  is the type of the viewed values.
+ */
+template <typename TValue>
+class property_view
+{
+public:
+    /**
+     * @class      iterator
+     * @brief      The random access iterator over the viewed values.
+     */
+    class iterator
+    {
+    public:
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = TValue;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const TValue*;
+        using reference = const TValue&;
+
+        iterator() = default;
+
+        iterator(const std::byte* position, std::ptrdiff_t stride) noexcept
+            : m_position { position }
+            , m_stride { stride }
+        {
+        }
+
+        reference operator*() const noexcept
+        {
+            return *reinterpret_cast<pointer>(m_position);
+        }
+
+        pointer operator->() const noexcept
+        {
+            return reinterpret_cast<pointer>(m_position);
+        }
+
+        reference operator[](difference_type offset) const noexcept
+        {
+            return *(*this + offset);
+        }
+
+        iterator& operator++() noexcept
+        {
+            m_position += m_stride;
+            return *this;
+        }
+
+        iterator operator++(int) noexcept
+        {
+            auto result = *this;
+            ++*this;
+            return result;
+        }
+
+        iterator& operator--() noexcept
+        {
+            m_position -= m_stride;
+            return *this;
+        }
+
+        iterator operator--(int) noexcept
+        {
+            auto result = *this;
+            --*this;
+            return result;
+        }
+
+        iterator& operator+=(difference_type offset) noexcept
+        {
+            m_position += offset * m_stride;
+            return *this;
+        }
+
+        iterator& operator-=(difference_type offset) noexcept
+        {
+            m_position -= offset * m_stride;
+            return *this;
+        }
+
+        friend iterator operator+(iterator it, difference_type offset) noexcept
+        {
+            return it += offset;
+        }
+
+        friend iterator operator+(difference_type offset, iterator it) noexcept
+        {
+            return it += offset;
+        }
+
+        friend iterator operator-(iterator it, difference_type offset) noexcept
+        {
+            return it -= offset;
+        }
+
+        friend difference_type operator-(const iterator& lhs, const iterator& rhs) noexcept
+        {
+            return (lhs.m_position - rhs.m_position) / lhs.m_stride;
+        }
+
+        friend bool operator==(const iterator& lhs, const iterator& rhs) noexcept
+        {
+            return lhs.m_position == rhs.m_position;
+        }
+
+        friend auto operator<=>(const iterator& lhs, const iterator& rhs) noexcept
+        {
+            return std::compare_three_way {}(lhs.m_position, rhs.m_position);
+        }
+
+    private:
+        const std::byte* m_position = nullptr;
+        std::ptrdiff_t m_stride = sizeof(TValue);
+    }; // class iterator
+
+public:
+    property_view() = default;
+
+    property_view(const TValue* data, std::size_t size,
+                  std::ptrdiff_t stride = sizeof(TValue)) noexcept
+        : m_data { reinterpret_cast<const std::byte*>(data) }
+        , m_size { size }
+        , m_stride { stride }
+    {
+    }
+
+    property_view(std::span<const TValue> values) noexcept
+        : property_view { values.data(), values.size() }
+    {
+    }
+
+    /**
+     * Views the property of every owner of the range.
+     *
+     * @param owners The contiguous range of owners, e.g. std::vector or std::array.
+     * @param member The pointer to the property member of the owner.
+     */
+    template <std::ranges::contiguous_range TRange, typename TOwner, typename TAccessPolicy>
+        requires(impl::is_public_get<TAccessPolicy>
+                 && std::is_same_v<std::remove_cv_t<std::ranges::range_value_t<TRange>>, TOwner>)
+    property_view(TRange&& owners, property<TOwner, TValue, TAccessPolicy> TOwner::* member)
+        noexcept
+        : m_size { static_cast<std::size_t>(std::ranges::size(owners)) }
+        , m_stride { sizeof(TOwner) }
+    {
+        if (m_size != 0)
+        {
+            const auto& first = std::as_const(*std::ranges::data(owners)).*member;
+            m_data = reinterpret_cast<const std::byte*>(&impl::property_access::value(first));
+        }
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return m_size;
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+    /**
+     * The distance between the viewed values in bytes.
+     */
+    [[nodiscard]] std::ptrdiff_t stride() const noexcept
+    {
+        return m_stride;
+    }
+
+    [[nodiscard]] bool is_contiguous() const noexcept
+    {
+        return m_stride == sizeof(TValue);
+    }
+
+    /**
+     * The first viewed value, the next ones follow at the stride.
+     */
+    [[nodiscard]] const TValue* data() const noexcept
+    {
+        return reinterpret_cast<const TValue*>(m_data);
+    }
+
+    [[nodiscard]] const TValue& operator[](std::size_t index) const noexcept
+    {
+        return *reinterpret_cast<const TValue*>(m_data + static_cast<std::ptrdiff_t>(index)
+                                                * m_stride);
+    }
+
+    [[nodiscard]] iterator begin() const noexcept
+    {
+        return iterator { m_data, m_stride };
+    }
+
+    [[nodiscard]] iterator end() const noexcept
+    {
+        return iterator { m_data + static_cast<std::ptrdiff_t>(m_size) * m_stride, m_stride };
+    }
+
+private:
+    /*
+     * The first viewed value.
+     */
+    const std::byte* m_data = nullptr;
+
+    /*
+     * The number of the viewed values.
+     */
+    std::size_t m_size = 0;
+
+    /*
+     * The distance between the viewed values in bytes.
+     */
+    std::ptrdiff_t m_stride = sizeof(TValue);
+}; // class property_view
+
+template <typename TRange, typename TOwner, typename TValue, typename TAccessPolicy>
+property_view(TRange&&, property<TOwner, TValue, TAccessPolicy> TOwner::*)
+    -> property_view<TValue>;
+
+template <typename TValue>
+property_view(std::span<TValue>) -> property_view<std::remove_const_t<TValue>>;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @internal
+ * @brief       The instruction sets of the vector kernels, for the contiguous arrays of float,
+ *              double and int32_t.
+ */
+enum class simd_level
+{
+    scalar,
+    avx2,
+    avx512f
+};
+
+/**
+ * @internal
+ * @brief       The instruction set of the kernels, the widest one the processor runs, detected
+ *              on the first reduction. The kernels are compiled for their instruction set only,
+ *              so every translation unit has the same kernels whatever flags it is built with.
+ *              The level may be lowered, e.g. by the tests, before the reductions run on other
+ *              threads.
+ */
+inline simd_level& active_simd_level() noexcept
+{
+    static simd_level level = []
+    {
+#if defined(PROPERTY_VIEW_X86_KERNELS)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f"))
+        {
+            return simd_level::avx512f;
+        }
+        if (__builtin_cpu_supports("avx2"))
+        {
+            return simd_level::avx2;
+        }
+#endif
+        return simd_level::scalar;
+    }();
+    return level;
+}
+
+enum class reduction
+{
+    sum,
+    min,
+    max
+};
+
+template <reduction TReduction, typename T>
+constexpr T combine(T lhs, T rhs) noexcept
+{
+    if constexpr (TReduction == reduction::sum)
+    {
+        return lhs + rhs;
+    }
+    else if constexpr (TReduction == reduction::min)
+    {
+        return rhs < lhs ? rhs : lhs;
+    }
+    else
+    {
+        return lhs < rhs ? rhs : lhs;
+    }
+}
+
+/**
+ * @internal
+ * @brief       The scalar loops keep four independent accumulators, so the strided loads of
+ *              the consecutive values overlap.
+ */
+template <reduction TReduction, typename T>
+T scalar_reduce(const property_view<T>& view, T initial) noexcept
+{
+    T accumulators[4] = { initial, initial, initial, initial };
+    const std::size_t size = view.size();
+    std::size_t i = 0;
+    for (; i + 4 <= size; i += 4)
+    {
+        accumulators[0] = combine<TReduction>(accumulators[0], view[i]);
+        accumulators[1] = combine<TReduction>(accumulators[1], view[i + 1]);
+        accumulators[2] = combine<TReduction>(accumulators[2], view[i + 2]);
+        accumulators[3] = combine<TReduction>(accumulators[3], view[i + 3]);
+    }
+    for (; i < size; ++i)
+    {
+        accumulators[0] = combine<TReduction>(accumulators[0], view[i]);
+    }
+    return combine<TReduction>(combine<TReduction>(accumulators[0], accumulators[1]),
+                               combine<TReduction>(accumulators[2], accumulators[3]));
+}
+
+template <typename T>
+std::size_t scalar_count(const T* data, std::size_t size, const T& value) noexcept
+{
+    std::size_t result = 0;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        result += data[i] == value ? 1 : 0;
+    }
+    return result;
+}
+
+#if defined(PROPERTY_VIEW_X86_KERNELS)
+
+/**
+ * @internal
+ * @brief       The AVX-512 instructions, the functions are compiled for AVX-512 only and run
+ *              after the processor check.
+ */
+template <typename T>
+struct avx512f_ops;
+
+template <>
+struct avx512f_ops<float>
+{
+    using vector = __m512;
+    static constexpr std::size_t lanes = 16;
+
+    [[gnu::target("avx512f")]]
+    static vector load(const float* data) noexcept { return _mm512_loadu_ps(data); }
+
+    [[gnu::target("avx512f")]]
+    static vector broadcast(float value) noexcept { return _mm512_set1_ps(value); }
+
+    [[gnu::target("avx512f")]]
+    static vector add(vector lhs, vector rhs) noexcept { return _mm512_add_ps(lhs, rhs); }
+
+    [[gnu::target("avx512f")]]
+    static vector min(vector lhs, vector rhs) noexcept { return _mm512_min_ps(lhs, rhs); }
+
+    [[gnu::target("avx512f")]]
+    static vector max(vector lhs, vector rhs) noexcept { return _mm512_max_ps(lhs, rhs); }
+
+    [[gnu::target("avx512f")]]
+    static float reduce_add(vector value) noexcept { return _mm512_reduce_add_ps(value); }
+
+    [[gnu::target("avx512f")]]
+    static float reduce_min(vector value) noexcept { return _mm512_reduce_min_ps(value); }
+
+    [[gnu::target("avx512f")]]
+    static float reduce_max(vector value) noexcept { return _mm512_reduce_max_ps(value); }
+
+    [[gnu::target("avx512f")]]
+    static std::size_t count_equal(vector lhs, vector rhs) noexcept
+    {
+        return static_cast<std::size_t>(std::popcount(
+            static_cast<unsigned>(_mm512_cmp_ps_mask(lhs, rhs, _CMP_EQ_OQ))));
+    }
+};
+
+template <>
+struct avx512f_ops<double>
+{
+    using vector = __m512d;
+    static constexpr std::size_t lanes = 8;
+
+    [[gnu::target("avx512f")]]
+    static vector load(const double* data) noexcept { return _mm512_loadu_pd(data); }
+
+    [[gnu::target("avx512f")]]
+    static vector broadcast(double value) noexcept { return _mm512_set1_pd(value); }
+
+    [[gnu::target("avx512f")]]
+    static vector add(vector lhs, vector rhs) noexcept { return _mm512_add_pd(lhs, rhs); }
+
+    [[gnu::target("avx512f")]]
+    static vector min(vector lhs, vector rhs) noexcept { return _mm512_min_pd(lhs, rhs); }
+
+    [[gnu::target("avx512f")]]
+    static vector max(vector lhs, vector rhs) noexcept { return _mm512_max_pd(lhs, rhs); }
+
+    [[gnu::target("avx512f")]]
+    static double reduce_add(vector value) noexcept { return _mm512_reduce_add_pd(value); }
+
+    [[gnu::target("avx512f")]]
+    static double reduce_min(vector value) noexcept { return _mm512_reduce_min_pd(value); }
+
+    [[gnu::target("avx512f")]]
+    static double reduce_max(vector value) noexcept { return _mm512_reduce_max_pd(value); }
+
+    [[gnu::target("avx512f")]]
+    static std::size_t count_equal(vector lhs, vector rhs) noexcept
+    {
+        return static_cast<std::size_t>(std::popcount(
+            static_cast<unsigned>(_mm512_cmp_pd_mask(lhs, rhs, _CMP_EQ_OQ))));
+    }
+};
+
+template <>
+struct avx512f_ops<std::int32_t>
+{
+    using vector = __m512i;
+    static constexpr std::size_t lanes = 16;
+
+    [[gnu::target("avx512f")]]
+    static vector load(const std::int32_t* data) noexcept { return _mm512_loadu_si512(data); }
+
+    [[gnu::target("avx512f")]]
+    static vector broadcast(std::int32_t value) noexcept { return _mm512_set1_epi32(value); }
+
+    [[gnu::target("avx512f")]]
+    static vector add(vector lhs, vector rhs) noexcept { return _mm512_add_epi32(lhs, rhs); }
+
+    [[gnu::target("avx512f")]]
+    static vector min(vector lhs, vector rhs) noexcept { return _mm512_min_epi32(lhs, rhs); }
+
+    [[gnu::target("avx512f")]]
+    static vector max(vector lhs, vector rhs) noexcept { return _mm512_max_epi32(lhs, rhs); }
+
+    [[gnu::target("avx512f")]]
+    static std::int32_t reduce_add(vector value) noexcept
+    {
+        return _mm512_reduce_add_epi32(value);
+    }
+
+    [[gnu::target("avx512f")]]
+    static std::int32_t reduce_min(vector value) noexcept
+    {
+        return _mm512_reduce_min_epi32(value);
+    }
+
+    [[gnu::target("avx512f")]]
+    static std::int32_t reduce_max(vector value) noexcept
+    {
+        return _mm512_reduce_max_epi32(value);
+    }
+
+    [[gnu::target("avx512f")]]
+    static std::size_t count_equal(vector lhs, vector rhs) noexcept
+    {
+        return static_cast<std::size_t>(std::popcount(
+            static_cast<unsigned>(_mm512_cmpeq_epi32_mask(lhs, rhs))));
+    }
+};
+
+/**
+ * @internal
+ * @brief       AVX2 has no horizontal reductions, the lanes are reduced one by one.
+ */
+template <typename T, std::size_t TLanes>
+struct avx2_lanes : std::array<T, TLanes>
+{
+    [[nodiscard]] T sum() const noexcept
+    {
+        T result {};
+        for (const auto lane : *this)
+        {
+            result += lane;
+        }
+        return result;
+    }
+
+    [[nodiscard]] T min() const noexcept
+    {
+        return *std::min_element(this->begin(), this->end());
+    }
+
+    [[nodiscard]] T max() const noexcept
+    {
+        return *std::max_element(this->begin(), this->end());
+    }
+};
+
+/**
+ * @internal
+ * @brief       The AVX2 instructions, the functions are compiled for AVX2 only and run after
+ *              the processor check.
+ */
+template <typename T>
+struct avx2_ops;
+
+template <>
+struct avx2_ops<float>
+{
+    using vector = __m256;
+    static constexpr std::size_t lanes = 8;
+    using lanes_type = avx2_lanes<float, lanes>;
+
+    [[gnu::target("avx2")]]
+    static float reduce_add(vector value) noexcept { return to_lanes(value).sum(); }
+
+    [[gnu::target("avx2")]]
+    static float reduce_min(vector value) noexcept { return to_lanes(value).min(); }
+
+    [[gnu::target("avx2")]]
+    static float reduce_max(vector value) noexcept { return to_lanes(value).max(); }
+
+    [[gnu::target("avx2")]]
+    static vector load(const float* data) noexcept { return _mm256_loadu_ps(data); }
+
+    [[gnu::target("avx2")]]
+    static vector broadcast(float value) noexcept { return _mm256_set1_ps(value); }
+
+    [[gnu::target("avx2")]]
+    static vector add(vector lhs, vector rhs) noexcept { return _mm256_add_ps(lhs, rhs); }
+
+    [[gnu::target("avx2")]]
+    static vector min(vector lhs, vector rhs) noexcept { return _mm256_min_ps(lhs, rhs); }
+
+    [[gnu::target("avx2")]]
+    static vector max(vector lhs, vector rhs) noexcept { return _mm256_max_ps(lhs, rhs); }
+
+    [[gnu::target("avx2")]]
+    static lanes_type to_lanes(vector value) noexcept
+    {
+        lanes_type result;
+        _mm256_storeu_ps(result.data(), value);
+        return result;
+    }
+
+    [[gnu::target("avx2")]]
+    static std::size_t count_equal(vector lhs, vector rhs) noexcept
+    {
+        return static_cast<std::size_t>(std::popcount(
+            static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(lhs, rhs, _CMP_EQ_OQ)))));
+    }
+};
+
+template <>
+struct avx2_ops<double>
+{
+    using vector = __m256d;
+    static constexpr std::size_t lanes = 4;
+    using lanes_type = avx2_lanes<double, lanes>;
+
+    [[gnu::target("avx2")]]
+    static double reduce_add(vector value) noexcept { return to_lanes(value).sum(); }
+
+    [[gnu::target("avx2")]]
+    static double reduce_min(vector value) noexcept { return to_lanes(value).min(); }
+
+    [[gnu::target("avx2")]]
+    static double reduce_max(vector value) noexcept { return to_lanes(value).max(); }
+
+    [[gnu::target("avx2")]]
+    static vector load(const double* data) noexcept { return _mm256_loadu_pd(data); }
+
+    [[gnu::target("avx2")]]
+    static vector broadcast(double value) noexcept { return _mm256_set1_pd(value); }
+
+    [[gnu::target("avx2")]]
+    static vector add(vector lhs, vector rhs) noexcept { return _mm256_add_pd(lhs, rhs); }
+
+    [[gnu::target("avx2")]]
+    static vector min(vector lhs, vector rhs) noexcept { return _mm256_min_pd(lhs, rhs); }
+
+    [[gnu::target("avx2")]]
+    static vector max(vector lhs, vector rhs) noexcept { return _mm256_max_pd(lhs, rhs); }
+
+    [[gnu::target("avx2")]]
+    static lanes_type to_lanes(vector value) noexcept
+    {
+        lanes_type result;
+        _mm256_storeu_pd(result.data(), value);
+        return result;
+    }
+
+    [[gnu::target("avx2")]]
+    static std::size_t count_equal(vector lhs, vector rhs) noexcept
+    {
+        return static_cast<std::size_t>(std::popcount(
+            static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_EQ_OQ)))));
+    }
+};
+
+template <>
+struct avx2_ops<std::int32_t>
+{
+    using vector = __m256i;
+    static constexpr std::size_t lanes = 8;
+    using lanes_type = avx2_lanes<std::int32_t, lanes>;
+
+    [[gnu::target("avx2")]]
+    static std::int32_t reduce_add(vector value) noexcept { return to_lanes(value).sum(); }
+
+    [[gnu::target("avx2")]]
+    static std::int32_t reduce_min(vector value) noexcept { return to_lanes(value).min(); }
+
+    [[gnu::target("avx2")]]
+    static std::int32_t reduce_max(vector value) noexcept { return to_lanes(value).max(); }
+
+    [[gnu::target("avx2")]]
+    static vector load(const std::int32_t* data) noexcept
+    {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+    }
+
+    [[gnu::target("avx2")]]
+    static vector broadcast(std::int32_t value) noexcept { return _mm256_set1_epi32(value); }
+
+    [[gnu::target("avx2")]]
+    static vector add(vector lhs, vector rhs) noexcept { return _mm256_add_epi32(lhs, rhs); }
+
+    [[gnu::target("avx2")]]
+    static vector min(vector lhs, vector rhs) noexcept { return _mm256_min_epi32(lhs, rhs); }
+
+    [[gnu::target("avx2")]]
+    static vector max(vector lhs, vector rhs) noexcept { return _mm256_max_epi32(lhs, rhs); }
+
+    [[gnu::target("avx2")]]
+    static lanes_type to_lanes(vector value) noexcept
+    {
+        lanes_type result;
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(result.data()), value);
+        return result;
+    }
+
+    [[gnu::target("avx2")]]
+    static std::size_t count_equal(vector lhs, vector rhs) noexcept
+    {
+        const auto equal = _mm256_castsi256_ps(_mm256_cmpeq_epi32(lhs, rhs));
+        return static_cast<std::size_t>(std::popcount(
+            static_cast<unsigned>(_mm256_movemask_ps(equal))));
+    }
+};
+
+/**
+ * @internal
+ * @brief       The kernels of one instruction set. The loops are repeated per instruction set,
+ *              since a function calls the vector instructions inline only if it is compiled for
+ *              them too.
+ */
+template <reduction TReduction, typename T>
+[[gnu::target("avx512f")]]
+T avx512f_reduce(const T* data, std::size_t size, T initial) noexcept
+{
+    using ops = avx512f_ops<T>;
+    auto accumulator = ops::broadcast(initial);
+    std::size_t i = 0;
+    for (; i + ops::lanes <= size; i += ops::lanes)
+    {
+        const auto values = ops::load(data + i);
+        if constexpr (TReduction == reduction::sum)
+        {
+            accumulator = ops::add(accumulator, values);
+        }
+        else if constexpr (TReduction == reduction::min)
+        {
+            accumulator = ops::min(accumulator, values);
+        }
+        else
+        {
+            accumulator = ops::max(accumulator, values);
+        }
+    }
+    T result = TReduction == reduction::sum ? ops::reduce_add(accumulator)
+             : TReduction == reduction::min ? ops::reduce_min(accumulator)
+                                            : ops::reduce_max(accumulator);
+    for (; i < size; ++i)
+    {
+        result = combine<TReduction>(result, data[i]);
+    }
+    return result;
+}
+
+template <typename T>
+[[gnu::target("avx512f")]]
+std::size_t avx512f_count(const T* data, std::size_t size, T value) noexcept
+{
+    using ops = avx512f_ops<T>;
+    const auto pattern = ops::broadcast(value);
+    std::size_t result = 0;
+    std::size_t i = 0;
+    for (; i + ops::lanes <= size; i += ops::lanes)
+    {
+        result += ops::count_equal(ops::load(data + i), pattern);
+    }
+    return result + scalar_count(data + i, size - i, value);
+}
+
+template <reduction TReduction, typename T>
+[[gnu::target("avx2")]]
+T avx2_reduce(const T* data, std::size_t size, T initial) noexcept
+{
+    using ops = avx2_ops<T>;
+    auto accumulator = ops::broadcast(initial);
+    std::size_t i = 0;
+    for (; i + ops::lanes <= size; i += ops::lanes)
+    {
+        const auto values = ops::load(data + i);
+        if constexpr (TReduction == reduction::sum)
+        {
+            accumulator = ops::add(accumulator, values);
+        }
+        else if constexpr (TReduction == reduction::min)
+        {
+            accumulator = ops::min(accumulator, values);
+        }
+        else
+        {
+            accumulator = ops::max(accumulator, values);
+        }
+    }
+    T result = TReduction == reduction::sum ? ops::reduce_add(accumulator)
+             : TReduction == reduction::min ? ops::reduce_min(accumulator)
+                                            : ops::reduce_max(accumulator);
+    for (; i < size; ++i)
+    {
+        result = combine<TReduction>(result, data[i]);
+    }
+    return result;
+}
+
+template <typename T>
+[[gnu::target("avx2")]]
+std::size_t avx2_count(const T* data, std::size_t size, T value) noexcept
+{
+    using ops = avx2_ops<T>;
+    const auto pattern = ops::broadcast(value);
+    std::size_t result = 0;
+    std::size_t i = 0;
+    for (; i + ops::lanes <= size; i += ops::lanes)
+    {
+        result += ops::count_equal(ops::load(data + i), pattern);
+    }
+    return result + scalar_count(data + i, size - i, value);
+}
+
+#endif
+
+/**
+ * @internal
+ * @brief       The types reduced by the vector kernels.
+ */
+template <typename T>
+inline constexpr bool has_simd_kernels =
+    std::is_same_v<T, float> || std::is_same_v<T, double> || std::is_same_v<T, std::int32_t>;
+
+/**
+ * @internal
+ * @brief       Reduces the contiguous view with the kernel of the active instruction set.
+ */
+template <reduction TReduction, typename T>
+T contiguous_reduce(const property_view<T>& view, T initial) noexcept
+{
+    switch (active_simd_level())
+    {
+#if defined(PROPERTY_VIEW_X86_KERNELS)
+    case simd_level::avx512f:
+        return avx512f_reduce<TReduction>(view.data(), view.size(), initial);
+    case simd_level::avx2:
+        return avx2_reduce<TReduction>(view.data(), view.size(), initial);
+#endif
+    default:
+        return scalar_reduce<TReduction>(view, initial);
+    }
+}
+
+template <typename T>
+std::size_t contiguous_count(const property_view<T>& view, const T& value) noexcept
+{
+    switch (active_simd_level())
+    {
+#if defined(PROPERTY_VIEW_X86_KERNELS)
+    case simd_level::avx512f:
+        return avx512f_count(view.data(), view.size(), value);
+    case simd_level::avx2:
+        return avx2_count(view.data(), view.size(), value);
+#endif
+    default:
+        return scalar_count(view.data(), view.size(), value);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Returns the sum of the viewed values. The order of the additions is unspecified, so the sum
+ * of the floating point values may differ from the sequential one in the last bits.
+ */
+template <typename TValue>
+[[nodiscard]] TValue sum(const property_view<TValue>& view) noexcept
+{
+    using impl::reduction;
+    if constexpr (impl::has_simd_kernels<TValue>)
+    {
+        if (view.is_contiguous())
+        {
+            return impl::contiguous_reduce<reduction::sum>(view, TValue {});
+        }
+    }
+    return impl::scalar_reduce<reduction::sum>(view, TValue {});
+}
+
+/**
+ * Returns the minimum of the viewed values, none for the empty view. The result is unspecified
+ * if the values contain NaN.
+ */
+template <typename TValue>
+[[nodiscard]] std::optional<TValue> min(const property_view<TValue>& view) noexcept
+{
+    using impl::reduction;
+    if (view.empty())
+    {
+        return std::nullopt;
+    }
+    if constexpr (impl::has_simd_kernels<TValue>)
+    {
+        if (view.is_contiguous())
+        {
+            return impl::contiguous_reduce<reduction::min>(view, view[0]);
+        }
+    }
+    return impl::scalar_reduce<reduction::min>(view, view[0]);
+}
+
+/**
+ * Returns the maximum of the viewed values, none for the empty view. The result is unspecified
+ * if the values contain NaN.
+ */
+template <typename TValue>
+[[nodiscard]] std::optional<TValue> max(const property_view<TValue>& view) noexcept
+{
+    using impl::reduction;
+    if (view.empty())
+    {
+        return std::nullopt;
+    }
+    if constexpr (impl::has_simd_kernels<TValue>)
+    {
+        if (view.is_contiguous())
+        {
+            return impl::contiguous_reduce<reduction::max>(view, view[0]);
+        }
+    }
+    return impl::scalar_reduce<reduction::max>(view, view[0]);
+}
+
+/**
+ * Returns the number of the viewed values equal to the given one.
+ */
+template <typename TValue>
+[[nodiscard]] std::size_t count(const property_view<TValue>& view, const TValue& value) noexcept
+{
+    if constexpr (impl::has_simd_kernels<TValue>)
+    {
+        if (view.is_contiguous())
+        {
+            return impl::contiguous_count(view, value);
+        }
+    }
+    std::size_t result = 0;
+    for (const auto& element : view)
+    {
+        result += element == value ? 1 : 0;
+    }
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace util
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#undef PROPERTY_VIEW_X86_KERNELS
+
+#endif // PROPERTY_PROPERTY_VIEW_H
@@ -0,0 +1,81 @@
+/**
+ * @file        access_functions.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       The functions compiled by both sides of the codegen equivalence test.
+ * @details     The including file declares public_get_set_owner, public_get_owner and
+ *              private_get_set_owner. The functions use C linkage, so both sides produce
+ *              the same symbol names regardless of the owner types.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef PROPERTY_TESTS_CODEGEN_ACCESS_FUNCTIONS_H
+#define PROPERTY_TESTS_CODEGEN_ACCESS_FUNCTIONS_H
+
+/**
+ * The small aggregate value.
+ */
+struct vec3
+{
+    double x;
+    double y;
+    double z;
+};
+
+#define CODEGEN_ACCESS_FUNCTIONS(suffix, T)                                                       \
+    extern "C" T& ref_public_get_set_##suffix(public_get_set_owner<T>& owner)                     \
+    {                                                                                             \
+        return owner.value;                                                                       \
+    }                                                                                             \
+    extern "C" T load_public_get_set_##suffix(public_get_set_owner<T>& owner)                     \
+    {                                                                                             \
+        T& value = owner.value;                                                                   \
+        return value;                                                                             \
+    }                                                                                             \
+    extern "C" void store_public_get_set_##suffix(public_get_set_owner<T>& owner, const T& value) \
+    {                                                                                             \
+        owner.value = value;                                                                      \
+    }                                                                                             \
+    extern "C" const T& ref_public_get_##suffix(public_get_owner<T>& owner)                       \
+    {                                                                                             \
+        return owner.value;                                                                       \
+    }                                                                                             \
+    extern "C" T load_public_get_##suffix(public_get_owner<T>& owner)                             \
+    {                                                                                             \
+        const T& value = owner.value;                                                             \
+        return value;                                                                             \
+    }                                                                                             \
+    extern "C" void store_public_get_##suffix(public_get_owner<T>& owner, const T& value)         \
+    {                                                                                             \
+        owner.set(value);                                                                         \
+    }                                                                                             \
+    extern "C" T load_private_get_set_##suffix(private_get_set_owner<T>& owner)                   \
+    {                                                                                             \
+        return owner.get();                                                                       \
+    }                                                                                             \
+    extern "C" void store_private_get_set_##suffix(private_get_set_owner<T>& owner,               \
+                                                   const T& value)                                \
+    {                                                                                             \
+        owner.set(value);                                                                         \
+    }
+
+CODEGEN_ACCESS_FUNCTIONS(int, int)
+CODEGEN_ACCESS_FUNCTIONS(double, double)
+CODEGEN_ACCESS_FUNCTIONS(vec3, vec3)
+
+extern "C" void increment_public_get_set_int(public_get_set_owner<int>& owner)
+{
+    owner.value++;
+}
+
+extern "C" int sum_public_get_int(public_get_owner<int>* owners, int count)
+{
+    int sum = 0;
+    for (int i = 0; i < count; ++i)
+    {
+        sum += owners[i].value;
+    }
+    return sum;
+}
+
+#endif // PROPERTY_TESTS_CODEGEN_ACCESS_FUNCTIONS_H
@@ -0,0 +1,56 @@
+########################################################################################################################
+# Compares the disassembly of two object files which define the same set of functions.
+#
+# Usage:
+#   cmake -DOBJDUMP=<objdump> -DPROPERTY_OBJECT=<object> -DRAW_OBJECT=<object> -P compare_disassembly.cmake
+#
+# The addresses, raw instruction bytes and the file headers are dropped, so only the instruction streams
+# are compared. The script fails listing the mismatched functions if the streams differ.
+########################################################################################################################
+
+function(disassemble object out_functions)
+    execute_process(
+        COMMAND ${OBJDUMP} -d --no-show-raw-insn --no-addresses ${object}
+        OUTPUT_VARIABLE disassembly
+        RESULT_VARIABLE result)
+    if (NOT result EQUAL 0)
+        message(FATAL_ERROR "Failed to disassemble ${object}.")
+    endif ()
+
+    # Keep the function bodies only, one list entry per function sorted by the function name.
+    string(REGEX REPLACE "^[^\n]*file format[^\n]*\n" "" disassembly "${disassembly}")
+    string(REGEX REPLACE "Disassembly of section [^\n]*\n" "" disassembly "${disassembly}")
+    string(REGEX REPLACE "[ \t]+" " " disassembly "${disassembly}")
+    string(REPLACE ";" "\\;" disassembly "${disassembly}")
+    string(REGEX REPLACE "\n+<" ";<" functions "${disassembly}")
+    list(FILTER functions INCLUDE REGEX "^<")
+    list(SORT functions)
+    set(${out_functions} "${functions}" PARENT_SCOPE)
+endfunction()
+
+disassemble(${PROPERTY_OBJECT} property_functions)
+disassemble(${RAW_OBJECT} raw_functions)
+
+list(LENGTH property_functions property_count)
+list(LENGTH raw_functions raw_count)
+if (NOT property_count EQUAL raw_count)
+    message(FATAL_ERROR "The function count differs: ${property_count} vs ${raw_count}.")
+endif ()
+
+set(mismatch_count 0)
+math(EXPR last_index "${property_count} - 1")
+foreach (index RANGE ${last_index})
+    list(GET property_functions ${index} property_function)
+    list(GET raw_functions ${index} raw_function)
+    string(STRIP "${property_function}" property_function)
+    string(STRIP "${raw_function}" raw_function)
+    if (NOT property_function STREQUAL raw_function)
+        math(EXPR mismatch_count "${mismatch_count} + 1")
+        message("The property access:\n${property_function}\n\nThe raw access:\n${raw_function}\n")
+    endif ()
+endforeach ()
+
+if (mismatch_count GREATER 0)
+    message(FATAL_ERROR "${mismatch_count} of ${property_count} functions compile differently.")
+endif ()
+message("All ${property_count} functions compile to the same instructions.")
@@ -0,0 +1,47 @@
+/**
+ * @file        property_access.cc
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       The property side of the codegen equivalence test.
+ * @details     Every function has a twin with the same name in raw_access.cc, which does
+ *              the same work on a plain member. The compiled functions must be identical.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#include "property.h"
+
+template <typename T>
+struct public_get_set_owner
+{
+    util::property<public_get_set_owner, T, util::public_get_set> value;
+};
+
+template <typename T>
+struct public_get_owner
+{
+    util::property<public_get_owner, T, util::public_get> value;
+
+    void set(const T& new_value)
+    {
+        value = new_value;
+    }
+};
+
+template <typename T>
+struct private_get_set_owner
+{
+    T get()
+    {
+        return value;
+    }
+
+    void set(const T& new_value)
+    {
+        value = new_value;
+    }
+
+private:
+    util::property<private_get_set_owner, T> value;
+};
+
+#include "access_functions.h"
@@ -0,0 +1,45 @@
+/**
+ * @file        raw_access.cc
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       The raw member side of the codegen equivalence test.
+ * @details     Every function has a twin with the same name in property_access.cc, which does
+ *              the same work through a property. The compiled functions must be identical.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+template <typename T>
+struct public_get_set_owner
+{
+    T value;
+};
+
+template <typename T>
+struct public_get_owner
+{
+    T value;
+
+    void set(const T& new_value)
+    {
+        value = new_value;
+    }
+};
+
+template <typename T>
+struct private_get_set_owner
+{
+    T get()
+    {
+        return value;
+    }
+
+    void set(const T& new_value)
+    {
+        value = new_value;
+    }
+
+private:
+    T value;
+};
+
+#include "access_functions.h"
@@ -7,6 +7,9 @@
  */
 
 #include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
 
 #include <gtest/gtest.h>
 
@@ -36,6 +39,114 @@ struct dummy_object
 };
 }
 
+namespace in_place
+{
+struct non_movable
+{
+    non_movable(int first, std::string second)
+        : first { first }
+        , second { std::move(second) }
+    {
+    }
+
+    non_movable(non_movable&&) = delete;
+
+    int first;
+    std::string second;
+};
+
+struct dummy_object
+{
+    util::property<dummy_object, std::mutex, util::public_get_set> mutex;
+    util::property<dummy_object, non_movable, util::public_get> value { std::in_place, 7, "seven" };
+    util::property<dummy_object, std::string, util::public_get> text { std::in_place, 3, 'a' };
+};
+}
+
+namespace assignment
+{
+struct counted
+{
+    counted() = default;
+
+    counted(const counted&)
+    {
+        ++copies;
+    }
+
+    counted(counted&&) noexcept
+    {
+        ++moves;
+    }
+
+    counted& operator=(const counted&)
+    {
+        ++copies;
+        return *this;
+    }
+
+    counted& operator=(counted&&) noexcept
+    {
+        ++moves;
+        return *this;
+    }
+
+    static inline int copies = 0;
+    static inline int moves = 0;
+};
+
+struct dummy_object
+{
+    util::property<dummy_object, counted, util::public_get_set> counter;
+    util::property<dummy_object, std::string, util::public_get_set> text;
+    util::property<dummy_object, std::string, util::public_get> read_only_text;
+
+    void set_read_only_text(const char* value)
+    {
+        read_only_text = value;
+    }
+};
+}
+
+namespace special_members
+{
+struct throwing_copy
+{
+    throwing_copy() = default;
+
+    throwing_copy(const throwing_copy&)
+    {
+        throw std::runtime_error { "copy" };
+    }
+};
+
+struct trivial_object
+{
+    util::property<trivial_object, int, util::public_get_set> first;
+    util::property<trivial_object, double, util::public_get> second;
+    util::property<trivial_object, long> third;
+};
+
+struct throwing_object
+{
+    util::property<throwing_object, throwing_copy, util::public_get_set> value;
+};
+
+using trivial_property = util::property<trivial_object, int, util::public_get_set>;
+
+static_assert(std::is_trivially_copyable_v<trivial_property>);
+static_assert(std::is_standard_layout_v<trivial_property>);
+static_assert(std::is_trivially_destructible_v<trivial_property>);
+static_assert(std::is_trivially_copyable_v<trivial_object>);
+static_assert(std::is_standard_layout_v<trivial_object>);
+static_assert(sizeof(trivial_property) == sizeof(int));
+
+static_assert(std::is_nothrow_move_constructible_v<util::property<trivial_object, std::string>>);
+static_assert(!std::is_nothrow_copy_constructible_v<util::property<trivial_object, std::string>>);
+static_assert(!std::is_nothrow_copy_constructible_v<throwing_object>);
+static_assert(!std::is_trivially_copyable_v<util::property<trivial_object, std::string>>);
+}
+
 template <typename T>
 constexpr bool is_public_read = requires(T obj, int val)
 {
@@ -102,6 +213,48 @@ TEST(property_api_testing, move_assigne_test)
     ASSERT_EQ (13, static_cast<int>(obj2.property));
 }
 
+TEST(property_api_testing, in_place_test)
+{
+    in_place::dummy_object obj;
+    const in_place::non_movable& value = obj.value;
+    ASSERT_EQ (7, value.first);
+    ASSERT_EQ ("seven", value.second);
+    ASSERT_EQ ("aaa", static_cast<const std::string&>(obj.text));
+    std::lock_guard lock { static_cast<std::mutex&>(obj.mutex) };
+}
+
+TEST(property_api_testing, rvalue_assigne_test)
+{
+    assignment::dummy_object obj;
+    assignment::counted::copies = 0;
+    assignment::counted::moves = 0;
+    obj.counter = assignment::counted {};
+    ASSERT_EQ (0, assignment::counted::copies);
+    ASSERT_EQ (1, assignment::counted::moves);
+
+    std::string text (64, 'a');
+    const auto* data = text.data();
+    obj.text = std::move(text);
+    ASSERT_EQ (data, static_cast<std::string&>(obj.text).data());
+}
+
+TEST(property_api_testing, forwarding_assigne_test)
+{
+    assignment::dummy_object obj;
+    obj.text = "literal";
+    ASSERT_EQ ("literal", static_cast<std::string&>(obj.text));
+    obj.set_read_only_text("read only");
+    ASSERT_EQ ("read only", static_cast<const std::string&>(obj.read_only_text));
+    ASSERT_FALSE((std::is_assignable_v<decltype(obj.read_only_text)&, const char*>));
+    ASSERT_FALSE((std::is_assignable_v<decltype(obj.read_only_text)&, std::string&&>));
+}
+
+TEST(property_api_testing, throwing_copy_test)
+{
+    special_members::throwing_object obj;
+    ASSERT_THROW (special_members::throwing_object { obj }, std::runtime_error);
+}
+
 int main(int argc, char** argv)
 {
     std::cout << "Property lib testing..." << std::endl;
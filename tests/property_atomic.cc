@@ -0,0 +1,109 @@
+/**
+ * @file        property_atomic.cc
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Unit tests of the atomic storage policy.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "property_atomic.h"
+
+namespace atomic_storage
+{
+struct dummy_object
+{
+    util::property<dummy_object, int, util::public_get_set, util::atomic> shared;
+    util::property<dummy_object, long, util::public_get, util::atomic> counter;
+    util::property<dummy_object, int, util::private_get_set, util::atomic> hidden;
+
+    void bump()
+    {
+        counter.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    int swap_hidden(int value)
+    {
+        return hidden.exchange(value);
+    }
+};
+
+template <typename T>
+constexpr bool is_public_load = requires(T property)
+{
+    property.load();
+};
+
+template <typename T>
+constexpr bool is_public_store = requires(T property)
+{
+    property.store(1);
+    property.fetch_add(1);
+};
+}
+
+TEST(property_atomic_testing, access_test)
+{
+    using object = atomic_storage::dummy_object;
+    ASSERT_TRUE(atomic_storage::is_public_load<decltype(object::shared)>);
+    ASSERT_TRUE(atomic_storage::is_public_store<decltype(object::shared)>);
+    ASSERT_TRUE(atomic_storage::is_public_load<decltype(object::counter)>);
+    ASSERT_FALSE(atomic_storage::is_public_store<decltype(object::counter)>);
+    ASSERT_FALSE(atomic_storage::is_public_load<decltype(object::hidden)>);
+    ASSERT_FALSE(atomic_storage::is_public_store<decltype(object::hidden)>);
+}
+
+TEST(property_atomic_testing, value_test)
+{
+    atomic_storage::dummy_object obj;
+    obj.shared = 12;
+    ASSERT_EQ (12, obj.shared.load(std::memory_order_acquire));
+    ASSERT_EQ (12, obj.shared.exchange(13));
+    int expected = 12;
+    ASSERT_FALSE(obj.shared.compare_exchange_strong(expected, 14));
+    ASSERT_EQ (13, expected);
+    ASSERT_TRUE(obj.shared.compare_exchange_strong(expected, 14, std::memory_order_acq_rel,
+                                                   std::memory_order_acquire));
+    obj.shared++;
+    ASSERT_EQ (15, static_cast<int>(obj.shared));
+    ASSERT_EQ (0, obj.swap_hidden(3));
+    ASSERT_EQ (3, obj.swap_hidden(4));
+}
+
+TEST(property_atomic_testing, copy_test)
+{
+    atomic_storage::dummy_object obj;
+    obj.shared = 13;
+    obj.bump();
+    auto copy { obj };
+    ASSERT_EQ (13, copy.shared.load());
+    ASSERT_EQ (1, copy.counter.load());
+}
+
+TEST(property_atomic_testing, concurrent_test)
+{
+    constexpr int thread_count = 4;
+    constexpr int iteration_count = 10000;
+    atomic_storage::dummy_object obj;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < thread_count; ++i)
+    {
+        threads.emplace_back([&obj] {
+            for (int j = 0; j < iteration_count; ++j)
+            {
+                obj.bump();
+                obj.shared.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    ASSERT_EQ (thread_count * iteration_count, obj.counter.load());
+    ASSERT_EQ (thread_count * iteration_count, obj.shared.load());
+}
@@ -0,0 +1,78 @@
+/**
+ * @file        property_cache_aligned.cc
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Unit tests of the cache_aligned storage policy.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "property_atomic.h"
+#include "property_cache_aligned.h"
+
+namespace cache_aligned_storage
+{
+constexpr auto line_size = util::impl::destructive_interference_size;
+
+struct dummy_object
+{
+    template <class T, class TAccessPolicy>
+    using counter_t = util::property<dummy_object, T, TAccessPolicy,
+                                     util::cache_aligned<util::atomic>>;
+
+    counter_t<long, util::public_get> received;
+    counter_t<long, util::public_get> processed;
+    util::property<dummy_object, std::string, util::public_get_set, util::cache_aligned<>> name;
+    util::property<dummy_object, int, util::public_get, util::cache_aligned<>> read_only;
+
+    void receive()
+    {
+        received.fetch_add(1, std::memory_order_relaxed);
+        read_only = 3;
+    }
+};
+
+static_assert(alignof(decltype(dummy_object::received)) == line_size);
+static_assert(sizeof(decltype(dummy_object::received)) == line_size);
+static_assert(sizeof(dummy_object) >= 4 * line_size);
+
+template <typename T>
+constexpr bool is_public_write = requires(T property)
+{
+    property = 1;
+};
+}
+
+TEST(property_cache_aligned_testing, access_test)
+{
+    using object = cache_aligned_storage::dummy_object;
+    ASSERT_FALSE(cache_aligned_storage::is_public_write<decltype(object::received)>);
+    ASSERT_FALSE(cache_aligned_storage::is_public_write<decltype(object::read_only)>);
+    ASSERT_TRUE((std::is_assignable_v<decltype(object::name)&, const char*>));
+}
+
+TEST(property_cache_aligned_testing, layout_test)
+{
+    cache_aligned_storage::dummy_object obj;
+    const auto received = reinterpret_cast<std::uintptr_t>(&obj.received);
+    const auto processed = reinterpret_cast<std::uintptr_t>(&obj.processed);
+    ASSERT_EQ (0u, received % cache_aligned_storage::line_size);
+    ASSERT_GE (processed - received, cache_aligned_storage::line_size);
+}
+
+TEST(property_cache_aligned_testing, value_test)
+{
+    cache_aligned_storage::dummy_object obj;
+    obj.receive();
+    obj.name = "worker";
+    ASSERT_EQ (1, obj.received.load());
+    ASSERT_EQ (3, static_cast<const int&>(obj.read_only));
+    auto copy { obj };
+    ASSERT_EQ ("worker", static_cast<std::string&>(copy.name));
+    ASSERT_EQ (1, copy.received.load());
+}
@@ -0,0 +1,126 @@
+/**
+ * @file        property_computed.cc
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Unit tests of the computed storage policy.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "property_computed.h"
+
+namespace computed_storage
+{
+struct dummy_object
+{
+    std::vector<int> values;
+    mutable int computations = 0;
+
+    int compute_sum() const
+    {
+        ++computations;
+        int sum = 0;
+        for (const auto value : values)
+        {
+            sum += value;
+        }
+        return sum;
+    }
+
+    util::property<dummy_object, int, util::public_get,
+                   util::computed<&dummy_object::compute_sum>> sum { *this };
+
+    util::property<dummy_object, std::string, util::public_get_set,
+                   util::computed<[](const dummy_object& self)
+                                  { return std::to_string(self.values.size()); }>>
+        label { *this };
+
+    util::property<dummy_object, int, util::private_get_set,
+                   util::computed<&dummy_object::compute_sum>> hidden { *this };
+
+    void add(int value)
+    {
+        values.push_back(value);
+        sum.invalidate();
+        hidden.invalidate();
+    }
+
+    int hidden_sum() const
+    {
+        return hidden;
+    }
+};
+
+template <typename T>
+constexpr bool is_public_invalidate = requires(T property)
+{
+    property.invalidate();
+};
+
+template <typename T>
+constexpr bool is_public_get = requires(const T property)
+{
+    property.get();
+};
+}
+
+TEST(property_computed_testing, access_test)
+{
+    using object = computed_storage::dummy_object;
+    ASSERT_FALSE(computed_storage::is_public_invalidate<decltype(object::sum)>);
+    ASSERT_TRUE(computed_storage::is_public_invalidate<decltype(object::label)>);
+    ASSERT_TRUE(computed_storage::is_public_get<decltype(object::sum)>);
+    ASSERT_FALSE(computed_storage::is_public_get<decltype(object::hidden)>);
+}
+
+TEST(property_computed_testing, cache_test)
+{
+    computed_storage::dummy_object obj;
+    ASSERT_FALSE(obj.sum.is_cached());
+    ASSERT_EQ (0, obj.sum.get());
+    ASSERT_EQ (1, obj.computations);
+
+    obj.add(2);
+    obj.add(3);
+    ASSERT_FALSE(obj.sum.is_cached());
+    int sum = obj.sum;
+    ASSERT_EQ (5, sum);
+    ASSERT_EQ (5, obj.sum.get());
+    ASSERT_EQ (2, obj.computations);
+    ASSERT_EQ (5, obj.hidden_sum());
+    ASSERT_EQ (3, obj.computations);
+
+    ASSERT_EQ ("2", obj.label.get());
+    obj.values.push_back(1);
+    ASSERT_EQ ("2", obj.label.get());
+    obj.label.invalidate();
+    ASSERT_EQ ("3", obj.label.get());
+}
+
+TEST(property_computed_testing, copy_test)
+{
+    computed_storage::dummy_object obj;
+    obj.add(7);
+    ASSERT_EQ (7, obj.sum.get());
+
+    auto copy { obj };
+    ASSERT_TRUE(copy.sum.is_cached());
+    copy.add(1);
+    ASSERT_EQ (8, copy.sum.get());
+    ASSERT_EQ (7, obj.sum.get());
+
+    obj = copy;
+    ASSERT_FALSE(obj.sum.is_cached());
+    ASSERT_EQ (8, obj.sum.get());
+
+    // Only the owner copies the property, which computes from the owner it is stored in.
+    using object = computed_storage::dummy_object;
+    ASSERT_FALSE(std::is_copy_constructible_v<decltype(object::sum)>);
+    ASSERT_FALSE(std::is_move_constructible_v<decltype(object::sum)>);
+    ASSERT_TRUE(std::is_copy_constructible_v<object>);
+}
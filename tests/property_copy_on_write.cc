@@ -0,0 +1,148 @@
+/**
+ * @file        property_copy_on_write.cc
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Unit tests of the copy_on_write storage policy.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "property_copy_on_write.h"
+
+namespace cow
+{
+struct document
+{
+    template <class T, class TAccess = util::public_get_set>
+    using property_t = util::property<document, T, TAccess, util::copy_on_write>;
+
+    property_t<std::vector<int>> blob { std::in_place, 1000, 7 };
+    property_t<std::string> title { "untitled" };
+    property_t<std::string, util::public_get> author { "nobody" };
+
+    void sign(const char* name)
+    {
+        author = name;
+    }
+};
+}
+
+TEST(property_copy_on_write_testing, sharing_test)
+{
+    cow::document original;
+    ASSERT_FALSE(original.blob.is_shared());
+
+    cow::document copy = original;
+    ASSERT_EQ (2u, original.blob.use_count());
+    ASSERT_EQ (&original.blob.get(), &copy.blob.get());
+    ASSERT_EQ (&original.title.get(), &copy.title.get());
+
+    // The mutable conversion clones only the mutated property.
+    static_cast<std::vector<int>&>(copy.blob).push_back(8);
+    ASSERT_FALSE(original.blob.is_shared());
+    ASSERT_FALSE(copy.blob.is_shared());
+    ASSERT_EQ (1000u, original.blob.get().size());
+    ASSERT_EQ (1001u, copy.blob.get().size());
+    ASSERT_TRUE(copy.title.is_shared());
+
+    // The assignment replaces the shared value without changing the other copies.
+    copy.title = "copy";
+    copy.sign("someone");
+    ASSERT_EQ ("untitled", original.title.get());
+    ASSERT_EQ ("nobody", original.author.get());
+    ASSERT_EQ ("copy", copy.title.get());
+    ASSERT_EQ ("someone", copy.author.get());
+
+    // The unique value is assigned in place.
+    const auto* title = &copy.title.get();
+    copy.title = std::string { "again" };
+    ASSERT_EQ (title, &copy.title.get());
+
+    // The values mutated through a reference are cloned by the copies, the assigned ones are
+    // shared, the moved from owner keeps its value.
+    cow::document moved = std::move(copy);
+    ASSERT_EQ (1u, moved.blob.use_count());
+    ASSERT_EQ (2u, moved.title.use_count());
+    ASSERT_EQ ("again", moved.title.get());
+    ASSERT_EQ ("again", copy.title.get());
+
+    copy = original;
+    ASSERT_EQ (1u, moved.blob.use_count());
+    ASSERT_EQ (2u, original.blob.use_count());
+}
+
+TEST(property_copy_on_write_testing, escaped_reference_test)
+{
+    // The reference taken before the copy does not change the copy.
+    cow::document original;
+    auto& blob = static_cast<std::vector<int>&>(original.blob);
+    cow::document copy = original;
+    blob.push_back(8);
+    ASSERT_EQ (1000u, copy.blob.get().size());
+    ASSERT_EQ (1001u, original.blob.get().size());
+    ASSERT_FALSE(original.blob.is_shared());
+
+    // The assignments do not hand out a mutable reference.
+    ASSERT_TRUE((std::is_same_v<decltype(original.title = "changed"), const std::string&>));
+
+    // The values never mutated through a reference are still shared.
+    cow::document second = original;
+    ASSERT_EQ (3u, original.author.use_count());
+    ASSERT_EQ (3u, original.title.use_count());
+}
+
+TEST(property_copy_on_write_testing, assign_then_copy_test)
+{
+    // The assigned template value is shared by the copies, as the constructed one is.
+    cow::document prototype;
+    prototype.blob = std::vector<int>(1 << 20);
+    prototype.title = "template";
+    cow::document first = prototype;
+    cow::document second = prototype;
+    cow::document third = prototype;
+    ASSERT_EQ (4u, prototype.blob.use_count());
+    ASSERT_EQ (&prototype.blob.get(), &third.blob.get());
+    ASSERT_EQ (4u, third.title.use_count());
+
+    // The assignment to the shared value replaces only the assigned copy.
+    first.blob = std::vector<int>(3);
+    ASSERT_EQ (3u, prototype.blob.use_count());
+    ASSERT_EQ (1u, first.blob.use_count());
+    first.blob = std::vector<int>(4);
+    cow::document fourth = first;
+    ASSERT_EQ (2u, first.blob.use_count());
+    ASSERT_EQ (4u, fourth.blob.get().size());
+}
+
+TEST(property_copy_on_write_testing, threads_test)
+{
+    const cow::document original;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&original, t]
+        {
+            for (int i = 0; i < 1000; ++i)
+            {
+                cow::document copy = original;
+                if (i % 2 == 0)
+                {
+                    static_cast<std::vector<int>&>(copy.blob)[0] = t;
+                    ASSERT_EQ (t, copy.blob.get()[0]);
+                }
+                ASSERT_EQ (7, original.blob.get()[0]);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    ASSERT_EQ (1u, original.blob.use_count());
+}
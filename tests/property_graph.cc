@@ -0,0 +1,248 @@
+/**
+ * @file        property_graph.cc
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Unit tests of the input and derived storage policies.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#include <memory>
+#include <type_traits>
+
+#include <gtest/gtest.h>
+
+#include "property_graph.h"
+
+namespace graph_storage
+{
+struct order
+{
+    template <class T, class TStoragePolicy = util::input>
+    using property_t = util::property<order, T, util::public_get_set, TStoragePolicy>;
+
+    double compute_total() const
+    {
+        ++total_computations;
+        return price.get() * quantity.get();
+    }
+
+    bool compute_is_large() const
+    {
+        ++is_large_computations;
+        return total.get() > 100.0;
+    }
+
+    double compute_report() const
+    {
+        ++report_computations;
+        return total.get() + (is_large.get() ? 1000.0 : 0.0);
+    }
+
+    mutable int total_computations = 0;
+    mutable int is_large_computations = 0;
+    mutable int report_computations = 0;
+
+    property_t<double> price { 1.0 };
+    property_t<int> quantity { 1 };
+    property_t<double, util::derived<&order::compute_total>> total { *this };
+    util::property<order, bool, util::public_get,
+                   util::derived<&order::compute_is_large>> is_large { *this };
+    property_t<double, util::derived<&order::compute_report>> report { *this };
+
+    order()
+    {
+        total.depends_on(price, quantity);
+        is_large.depends_on(total);
+        report.depends_on(total, is_large);
+    }
+
+    // The copies of the derived properties are not linked, so the copy declares the graph again.
+    order(const order& other)
+        : order()
+    {
+        *this = other;
+    }
+
+    order& operator=(const order&) = default;
+};
+
+struct portfolio
+{
+    double compute_value() const
+    {
+        return first->total.get() + second->total.get();
+    }
+
+    std::unique_ptr<order> first = std::make_unique<order>();
+    std::unique_ptr<order> second = std::make_unique<order>();
+    util::property<portfolio, double, util::public_get,
+                   util::derived<&portfolio::compute_value>> value { *this };
+
+    portfolio()
+    {
+        value.depends_on(first->total, second->total);
+    }
+};
+
+struct choice
+{
+    template <class T, class TStoragePolicy = util::input>
+    using property_t = util::property<choice, T, util::public_get_set, TStoragePolicy>;
+
+    int compute_selected() const
+    {
+        ++computations;
+        return use_second.get() ? second.get() : first.get();
+    }
+
+    int compute_doubled() const
+    {
+        return 2 * first.get();
+    }
+
+    int compute_sum() const
+    {
+        return doubled.get() + selected.get() + second.get();
+    }
+
+    mutable int computations = 0;
+
+    property_t<bool> use_second { false };
+    property_t<int> first { 1 };
+    property_t<int> second { 0 };
+    property_t<int, util::derived<&choice::compute_selected>> selected { *this };
+    property_t<int, util::derived<&choice::compute_doubled>> doubled { *this };
+    property_t<int, util::derived<&choice::compute_sum>> sum { *this };
+};
+
+template <typename T>
+constexpr bool is_public_depends_on = requires(T property, order::property_t<int> source)
+{
+    property.depends_on(source);
+};
+}
+
+TEST(property_graph_testing, access_test)
+{
+    using object = graph_storage::order;
+    ASSERT_TRUE(graph_storage::is_public_depends_on<decltype(object::total)>);
+    ASSERT_FALSE(graph_storage::is_public_depends_on<decltype(object::is_large)>);
+}
+
+TEST(property_graph_testing, glitch_free_test)
+{
+    graph_storage::order obj;
+    ASSERT_EQ (1.0, obj.report.get());
+    ASSERT_EQ (1, obj.total_computations);
+    ASSERT_EQ (1, obj.is_large_computations);
+    ASSERT_EQ (1, obj.report_computations);
+
+    obj.price = 50.0;
+    obj.quantity = 4;
+    ASSERT_TRUE(obj.report.is_stale());
+    ASSERT_EQ (1200.0, obj.report.get());
+    ASSERT_EQ (2, obj.total_computations);
+    ASSERT_EQ (2, obj.is_large_computations);
+    ASSERT_EQ (2, obj.report_computations);
+    ASSERT_FALSE(obj.report.is_stale());
+
+    ASSERT_EQ (1200.0, obj.report.get());
+    ASSERT_EQ (2, obj.report_computations);
+}
+
+TEST(property_graph_testing, minimal_recomputation_test)
+{
+    graph_storage::order obj;
+    obj.price = 200.0;
+    ASSERT_EQ (1200.0, obj.report.get());
+
+    // The total is unchanged, so nothing below it is recomputed.
+    obj.price = 100.0;
+    obj.quantity = 2;
+    ASSERT_EQ (1200.0, obj.report.get());
+    ASSERT_EQ (2, obj.total_computations);
+    ASSERT_EQ (1, obj.is_large_computations);
+    ASSERT_EQ (1, obj.report_computations);
+
+    // The total changes, but is_large does not, so only the report is recomputed after it.
+    obj.quantity = 3;
+    ASSERT_EQ (1300.0, obj.report.get());
+    ASSERT_EQ (2, obj.is_large_computations);
+    ASSERT_EQ (2, obj.report_computations);
+
+    // The reads of a derived property do not recompute its dependents.
+    obj.price = 1.0;
+    ASSERT_EQ (3.0, obj.total.get());
+    ASSERT_EQ (4, obj.total_computations);
+    ASSERT_EQ (2, obj.is_large_computations);
+    ASSERT_EQ (3.0, obj.report.get());
+    ASSERT_EQ (3, obj.is_large_computations);
+    ASSERT_EQ (4, obj.total_computations);
+}
+
+TEST(property_graph_testing, cross_owner_test)
+{
+    graph_storage::portfolio obj;
+    ASSERT_EQ (2.0, obj.value.get());
+    obj.first->price = 10.0;
+    obj.second->quantity = 5;
+    ASSERT_EQ (15.0, obj.value.get());
+
+    obj.first.reset();
+    obj.second->price = 2.0;
+    ASSERT_TRUE(obj.value.is_stale());
+}
+
+TEST(property_graph_testing, copy_test)
+{
+    graph_storage::order obj;
+    obj.price = 3.0;
+    graph_storage::order copy { obj };
+    ASSERT_EQ (3.0, copy.total.get());
+    copy.quantity = 2;
+    ASSERT_EQ (6.0, copy.total.get());
+    ASSERT_EQ (3.0, obj.total.get());
+
+    obj = copy;
+    ASSERT_EQ (6.0, obj.total.get());
+    obj.price = 1.0;
+    ASSERT_EQ (2.0, obj.total.get());
+
+    // Only the owner copies the properties.
+    using order = graph_storage::order;
+    ASSERT_FALSE(std::is_copy_constructible_v<decltype(order::price)>);
+    ASSERT_FALSE(std::is_copy_constructible_v<decltype(order::total)>);
+    ASSERT_FALSE(std::is_move_constructible_v<decltype(order::total)>);
+    ASSERT_TRUE(std::is_copy_constructible_v<order>);
+}
+
+TEST(property_graph_testing, recorded_sources_test)
+{
+    // The sources read by the compute function are recorded, also without depends_on.
+    graph_storage::choice obj;
+    ASSERT_EQ (1, obj.selected.get());
+    ASSERT_EQ (1, obj.computations);
+
+    // The unread source does not mark the property stale.
+    obj.second = 5;
+    ASSERT_FALSE(obj.selected.is_stale());
+    obj.first = 2;
+    ASSERT_TRUE(obj.selected.is_stale());
+    ASSERT_EQ (2, obj.selected.get());
+
+    // The new branch reads the other source, which is recorded on the recompute.
+    obj.use_second = true;
+    ASSERT_EQ (5, obj.selected.get());
+    obj.first = 3;
+    ASSERT_FALSE(obj.selected.is_stale());
+    obj.second = 6;
+    ASSERT_EQ (6, obj.selected.get());
+    ASSERT_EQ (4, obj.computations);
+
+    // All stale sources are refreshed, even after an earlier one has changed.
+    obj.use_second = false;
+    obj.first = 4;
+    ASSERT_EQ (18, obj.sum.get());
+    ASSERT_FALSE(obj.selected.is_stale());
+    ASSERT_FALSE(obj.doubled.is_stale());
+}
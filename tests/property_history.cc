@@ -0,0 +1,200 @@
+/**
+ * @file        property_history.cc
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Unit tests of the undo/redo history and the undoable storage policy.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#include <array>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "property_history.h"
+
+namespace history
+{
+struct shape
+{
+    template <class T, class TAccess = util::public_get_set>
+    using property_t = util::property<shape, T, TAccess, util::undoable>;
+
+    util::history_handle edits;
+    property_t<float> x { edits };
+    property_t<float> y { edits, 1.0f };
+    property_t<int, util::public_get> layer { edits, 3 };
+
+    void move_to_layer(int new_layer)
+    {
+        layer = new_layer;
+    }
+};
+}
+
+TEST(property_history_testing, undo_redo_test)
+{
+    util::history edits;
+    history::shape s { util::history_handle { edits } };
+    ASSERT_FALSE(edits.can_undo());
+    ASSERT_FALSE(edits.undo());
+
+    s.x = 1.0f;
+    s.y = 2.0f;
+    edits.checkpoint();
+    s.x = 5.0f;
+    s.move_to_layer(7);
+    ASSERT_EQ (1u, edits.steps());
+    ASSERT_EQ (4u, edits.records());
+    ASSERT_TRUE(edits.can_undo());
+
+    // The open step is closed by undo.
+    ASSERT_TRUE(edits.undo());
+    ASSERT_EQ (1.0f, s.x.get());
+    ASSERT_EQ (3, s.layer.get());
+    ASSERT_TRUE(edits.undo());
+    ASSERT_EQ (0.0f, s.x.get());
+    ASSERT_EQ (1.0f, s.y.get());
+    ASSERT_FALSE(edits.undo());
+
+    ASSERT_TRUE(edits.redo());
+    ASSERT_EQ (1.0f, s.x.get());
+    ASSERT_EQ (2.0f, s.y.get());
+    ASSERT_TRUE(edits.redo());
+    ASSERT_EQ (5.0f, s.x.get());
+    ASSERT_EQ (7, s.layer.get());
+    ASSERT_FALSE(edits.redo());
+
+    // A write after undo drops the redo steps.
+    edits.undo();
+    s.y = 9.0f;
+    ASSERT_FALSE(edits.can_redo());
+    ASSERT_EQ (1u, edits.steps());
+    ASSERT_EQ (3u, edits.records());
+    edits.undo();
+    ASSERT_EQ (2.0f, s.y.get());
+    edits.redo();
+    ASSERT_EQ (9.0f, s.y.get());
+
+    edits.clear();
+    ASSERT_FALSE(edits.can_undo());
+    ASSERT_EQ (0u, edits.memory_usage());
+}
+
+TEST(property_history_testing, owners_test)
+{
+    util::history edits;
+    std::vector<history::shape> shapes(3, history::shape { util::history_handle { edits } });
+    for (auto& s : shapes)
+    {
+        s.x = 10.0f;
+    }
+    edits.checkpoint();
+
+    // The copy of the owner records to the same history.
+    history::shape copy = shapes[0];
+    copy = shapes[1];
+    copy.x = 20.0f;
+    edits.undo();
+    ASSERT_EQ (10.0f, copy.x.get());
+    edits.undo();
+    for (const auto& s : shapes)
+    {
+        ASSERT_EQ (0.0f, s.x.get());
+    }
+
+    // The unbound owners are not recorded.
+    history::shape local;
+    local.x = 1.0f;
+    ASSERT_EQ (3u + 4u, edits.records());
+}
+
+TEST(property_history_testing, arena_test)
+{
+    util::history edits;
+    history::shape s { util::history_handle { edits } };
+    constexpr int write_count = 100'000;
+    for (int i = 1; i <= write_count; ++i)
+    {
+        s.x = static_cast<float>(i);
+        if (i % 10 == 0)
+        {
+            edits.checkpoint();
+        }
+    }
+    ASSERT_EQ (std::size_t(write_count / 10), edits.steps());
+
+    // The records are compact, far below a copy of the owner per edit.
+    const auto usage = edits.memory_usage();
+    ASSERT_LT (usage, std::size_t(write_count) * 64);
+
+    for (int i = 0; i < write_count / 20; ++i)
+    {
+        edits.undo();
+    }
+    ASSERT_EQ (static_cast<float>(write_count / 2), s.x.get());
+
+    // The rewound arena is reused by the new writes.
+    for (int i = 0; i < write_count / 2; ++i)
+    {
+        s.y = static_cast<float>(i);
+    }
+    ASSERT_EQ (usage, edits.memory_usage());
+    while (edits.undo())
+    {
+    }
+    ASSERT_EQ (0.0f, s.x.get());
+    ASSERT_EQ (1.0f, s.y.get());
+}
+
+TEST(property_history_testing, lifetime_test)
+{
+    util::history edits;
+    std::vector<history::shape> shapes;
+    shapes.emplace_back(util::history_handle { edits });
+    shapes[0].x = 1.0f;
+    edits.checkpoint();
+
+    // The moved owner is written by undo, not the freed one.
+    shapes.reserve(shapes.capacity() + 10);
+    shapes[0].x = 2.0f;
+    edits.undo();
+    ASSERT_EQ (1.0f, shapes[0].x.get());
+    edits.undo();
+    ASSERT_EQ (0.0f, shapes[0].x.get());
+    edits.redo();
+    ASSERT_EQ (1.0f, shapes[0].x.get());
+
+    // The records of the destroyed owner are skipped, its id is reused by the new one.
+    {
+        history::shape temporary { util::history_handle { edits } };
+        temporary.x = 5.0f;
+    }
+    history::shape next { util::history_handle { edits } };
+    next.y = 3.0f;
+    edits.checkpoint();
+    edits.undo();
+    ASSERT_EQ (1.0f, next.y.get());
+    ASSERT_EQ (0.0f, next.x.get());
+    edits.redo();
+    ASSERT_EQ (3.0f, next.y.get());
+    ASSERT_EQ (0.0f, next.x.get());
+
+    // The owners may outlive the history.
+    std::unique_ptr<history::shape> survivor;
+    {
+        util::history local;
+        history::shape bound { util::history_handle { local } };
+        survivor = std::make_unique<history::shape>(bound);
+        survivor->x = 4.0f;
+    }
+    survivor->x = 6.0f;
+    ASSERT_FALSE(survivor->edits.is_bound());
+
+    // Only the owner copies and moves the properties.
+    ASSERT_FALSE(std::is_copy_constructible_v<decltype(history::shape::x)>);
+    ASSERT_FALSE(std::is_move_constructible_v<decltype(history::shape::x)>);
+    ASSERT_TRUE(std::is_move_constructible_v<history::shape>);
+}
@@ -0,0 +1,201 @@
+/**
+ * @file        property_journal.cc
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Unit tests of the write-ahead journal and the journaled storage policy.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "property_journal.h"
+#include "temporary_file.h"
+
+namespace journaling
+{
+struct account
+{
+    template <class T, std::uint32_t I, class TAccess = util::public_get_set>
+    using property_t = util::property<account, T, TAccess, util::journaled<I>>;
+
+    util::journal_handle log;
+    property_t<long, 0> balance { log };
+    property_t<int, 1> limit { log, 500 };
+    property_t<double, 2, util::public_get> rate { log, 0.5 };
+
+    using properties = util::property_list<
+        util::member<"balance", &account::balance>,
+        util::member<"limit", &account::limit>,
+        util::member<"rate", &account::rate>>;
+
+    void set_rate(double new_rate)
+    {
+        rate = new_rate;
+    }
+};
+}
+
+TEST(property_journal_testing, replay_test)
+{
+    testing_support::temporary_file file;
+    {
+        util::journal log { file.path() };
+        journaling::account first { util::journal_handle { log, 1 } };
+        journaling::account second { util::journal_handle { log, 2 } };
+        first.balance = 100;
+        second.balance = 7;
+        first.limit = 1000;
+        first.set_rate(0.25);
+        ASSERT_EQ (0.25, first.rate.get());
+
+        // The copy writes to the journal of the same owner id, only the owner copies the
+        // properties.
+        journaling::account copy = first;
+        copy.balance = 150;
+        ASSERT_FALSE(std::is_copy_constructible_v<decltype(journaling::account::balance)>);
+        log.flush();
+        ASSERT_EQ (5u, util::journal::replay(file.path(), [](auto, auto, auto) { }));
+
+        // The unbound owners are not journaled.
+        journaling::account local;
+        local.balance = 1;
+    }
+
+    std::map<std::uint64_t, journaling::account> owners;
+    const auto records = util::journal::replay(file.path(),
+        [&](std::uint64_t owner_id, std::uint32_t index, std::span<const std::byte> value)
+        {
+            ASSERT_TRUE(util::apply_journal_record(owners[owner_id], index, value));
+        });
+    ASSERT_EQ (5u, records);
+    ASSERT_EQ (2u, owners.size());
+    ASSERT_EQ (150, owners[1].balance);
+    ASSERT_EQ (1000, owners[1].limit);
+    ASSERT_EQ (0.25, owners[1].rate.get());
+    ASSERT_EQ (7, owners[2].balance);
+    ASSERT_EQ (500, owners[2].limit);
+
+    journaling::account target;
+    const long value = 1;
+    ASSERT_FALSE(util::apply_journal_record(target, 3, std::as_bytes(std::span { &value, 1 })));
+    ASSERT_FALSE(util::apply_journal_record(target, 1, std::as_bytes(std::span { &value, 1 })));
+}
+
+TEST(property_journal_testing, torn_tail_test)
+{
+    testing_support::temporary_file file;
+    {
+        util::journal log { file.path() };
+        journaling::account owner { util::journal_handle { log, 1 } };
+        for (long i = 1; i <= 10; ++i)
+        {
+            owner.balance = i;
+        }
+    }
+    const auto size = std::filesystem::file_size(file.path());
+    std::filesystem::resize_file(file.path(), size - 3);
+
+    long balance = 0;
+    const auto records = util::journal::replay(file.path(),
+        [&](std::uint64_t, std::uint32_t, std::span<const std::byte> value)
+        {
+            std::memcpy(&balance, value.data(), sizeof(balance));
+        });
+    ASSERT_EQ (9u, records);
+    ASSERT_EQ (9, balance);
+
+    const auto ignore = [](auto, auto, auto) { };
+    ASSERT_THROW(util::journal::replay("/nonexistent/directory/state.log", ignore),
+                 std::system_error);
+    ASSERT_THROW(util::journal { "/nonexistent/directory/state.log" }, std::system_error);
+}
+
+TEST(property_journal_testing, restart_after_tear_test)
+{
+    testing_support::temporary_file file;
+    {
+        util::journal log { file.path() };
+        journaling::account owner { util::journal_handle { log, 1 } };
+        owner.balance = 1;
+        owner.balance = 2;
+    }
+    // The crash leaves a torn record and garbage after the valid ones.
+    const auto size = std::filesystem::file_size(file.path());
+    std::filesystem::resize_file(file.path(), size - 3);
+    {
+        std::ofstream stream { file.path(), std::ios::binary | std::ios::app };
+        stream << "garbage after the torn record";
+    }
+    {
+        util::journal log { file.path() };
+        ASSERT_EQ (size - sizeof(util::impl::journal_record_header) - sizeof(long),
+                   std::filesystem::file_size(file.path()));
+        journaling::account owner { util::journal_handle { log, 1 } };
+        owner.balance = 3;
+        owner.limit = 4;
+        log.flush();
+    }
+
+    journaling::account owner;
+    const auto records = util::journal::replay(file.path(),
+        [&](std::uint64_t, std::uint32_t index, std::span<const std::byte> value)
+        {
+            util::apply_journal_record(owner, index, value);
+        });
+    ASSERT_EQ (3u, records);
+    ASSERT_EQ (3, owner.balance);
+    ASSERT_EQ (4, owner.limit);
+}
+
+TEST(property_journal_testing, group_commit_test)
+{
+    testing_support::temporary_file file;
+    constexpr int thread_count = 4;
+    constexpr long write_count = 2000;
+    {
+        // The small buffer makes the writers wait for the background thread.
+        util::journal log { file.path(), 256 };
+        std::vector<std::thread> threads;
+        for (int t = 0; t < thread_count; ++t)
+        {
+            threads.emplace_back([&log, t]
+            {
+                journaling::account owner { util::journal_handle { log, std::uint64_t(t) } };
+                for (long i = 1; i <= write_count; ++i)
+                {
+                    owner.balance = i;
+                }
+                log.flush();
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        ASSERT_THROW(log.append(0, 0, std::vector<std::byte>(256)), std::length_error);
+    }
+
+    std::map<std::uint64_t, journaling::account> owners;
+    std::map<std::uint64_t, long> last;
+    bool ordered = true;
+    const auto records = util::journal::replay(file.path(),
+        [&](std::uint64_t owner_id, std::uint32_t index, std::span<const std::byte> value)
+        {
+            util::apply_journal_record(owners[owner_id], index, value);
+            ordered = ordered && owners[owner_id].balance == last[owner_id] + 1;
+            last[owner_id] = owners[owner_id].balance;
+        });
+    ASSERT_EQ (std::size_t(thread_count * write_count), records);
+    ASSERT_TRUE(ordered);
+    for (int t = 0; t < thread_count; ++t)
+    {
+        ASSERT_EQ (write_count, owners[t].balance);
+    }
+}
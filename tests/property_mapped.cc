@@ -0,0 +1,147 @@
+/**
+ * @file        property_mapped.cc
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Unit tests of the memory-mapped arena of owners.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#include <fstream>
+#include <system_error>
+
+#include <gtest/gtest.h>
+
+#include "property_mapped.h"
+#include "temporary_file.h"
+
+namespace mapped
+{
+struct account
+{
+    template <class ... TArgs>
+    using property_t = util::property<account, TArgs...>;
+
+    property_t<long, util::public_get_set> balance;
+    property_t<int, util::public_get> id;
+
+    using properties = util::property_list<
+        util::member<"balance", &account::balance>,
+        util::member<"id", &account::id>>;
+
+    account() = default;
+
+    explicit account(int new_id)
+        : id { new_id }
+    {
+    }
+};
+
+struct other_account
+{
+    util::property<other_account, long, util::public_get_set> balance;
+    util::property<other_account, int, util::public_get> id;
+
+    using properties = util::property_list<
+        util::member<"balance", &other_account::balance>,
+        util::member<"number", &other_account::id>>;
+};
+
+/*
+ * The same layout as account, with the new meaning of the balance.
+ */
+struct next_account : account
+{
+    static constexpr std::uint64_t layout_version = 2;
+};
+}
+
+TEST(property_mapped_testing, persistence_test)
+{
+    testing_support::temporary_file file;
+    {
+        util::mapped_arena<mapped::account> accounts { file.path(), 2 };
+        ASSERT_TRUE(accounts.empty());
+        ASSERT_EQ (2u, accounts.capacity());
+        for (int i = 0; i < 5; ++i)
+        {
+            accounts.emplace_back(i).balance = i * 100L;
+        }
+        ASSERT_EQ (5u, accounts.size());
+        ASSERT_EQ (8u, accounts.capacity());
+        accounts[4].balance = 7;
+        accounts.flush();
+    }
+    {
+        util::mapped_arena<mapped::account> accounts { file.path(), 1 };
+        ASSERT_EQ (5u, accounts.size());
+        ASSERT_EQ (8u, accounts.capacity());
+        long total = 0;
+        for (auto& account : accounts)
+        {
+            total += account.balance;
+        }
+        ASSERT_EQ (607, total);
+        ASSERT_EQ (3, static_cast<const int&>(accounts[3].id));
+        accounts.pop_back();
+        accounts.flush_async();
+    }
+    util::mapped_arena<mapped::account> accounts { file.path(), 100 };
+    ASSERT_EQ (4u, accounts.size());
+    ASSERT_EQ (100u, accounts.capacity());
+}
+
+TEST(property_mapped_testing, move_test)
+{
+    testing_support::temporary_file file;
+    util::mapped_arena<mapped::account> accounts { file.path() };
+    accounts.emplace_back(1).balance = 10;
+    auto moved { std::move(accounts) };
+    ASSERT_EQ (1u, moved.size());
+    ASSERT_EQ (10, static_cast<const long&>(moved[0].balance));
+
+    // The moved from arena is empty.
+    ASSERT_TRUE(accounts.empty());
+    ASSERT_EQ (0u, accounts.capacity());
+    ASSERT_EQ (accounts.begin(), accounts.end());
+    accounts.flush();
+    accounts.flush_async();
+
+    accounts = std::move(moved);
+    ASSERT_EQ (1u, accounts.size());
+}
+
+TEST(property_mapped_testing, layout_test)
+{
+    ASSERT_EQ (offsetof(mapped::account, id),
+               (util::impl::member_offset<mapped::account, &mapped::account::id>()));
+    ASSERT_NE (util::impl::layout_hash<mapped::account>(),
+               util::impl::layout_hash<mapped::other_account>());
+    ASSERT_NE (util::impl::layout_hash<mapped::account>(),
+               util::impl::layout_hash<mapped::next_account>());
+    ASSERT_EQ (2u, util::layout_version<mapped::next_account>);
+
+    testing_support::temporary_file file;
+    {
+        util::mapped_arena<mapped::account> accounts { file.path() };
+        accounts.emplace_back(1);
+    }
+    ASSERT_THROW(util::mapped_arena<mapped::other_account> { file.path() }, std::system_error);
+    ASSERT_THROW(util::mapped_arena<mapped::next_account> { file.path() }, std::system_error);
+
+    {
+        std::ofstream stream { file.path(), std::ios::binary | std::ios::trunc };
+        stream << "not an arena, but long enough to have a header";
+    }
+    try
+    {
+        util::mapped_arena<mapped::account> accounts { file.path() };
+        FAIL();
+    }
+    catch (const std::system_error& error)
+    {
+        ASSERT_EQ (std::errc::invalid_argument, error.code());
+    }
+
+    ASSERT_THROW(util::mapped_arena<mapped::account> { "/nonexistent/directory/arena.bin" },
+                 std::system_error);
+}
@@ -0,0 +1,224 @@
+/**
+ * @file        property_observable.cc
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Unit tests of the observable storage policy.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "property_observable.h"
+
+namespace observable_storage
+{
+struct dummy_object
+{
+    util::property<dummy_object, std::string, util::public_get_set, util::observable<>> title;
+    util::property<dummy_object, int, util::public_get, util::observable<1>> revision;
+
+    void bump()
+    {
+        revision.modify([](int& value) { ++value; });
+    }
+};
+
+struct recorder
+{
+    std::vector<std::pair<std::string, std::string>> changes;
+};
+
+template <typename T>
+constexpr bool is_public_write = requires(T property)
+{
+    property = 1;
+};
+}
+
+TEST(property_observable_testing, access_test)
+{
+    using object = observable_storage::dummy_object;
+    ASSERT_FALSE(observable_storage::is_public_write<decltype(object::revision)>);
+    ASSERT_FALSE((std::is_convertible_v<decltype(object::title)&, std::string&>));
+    ASSERT_TRUE((std::is_convertible_v<decltype(object::title)&, const std::string&>));
+}
+
+TEST(property_observable_testing, notification_test)
+{
+    observable_storage::dummy_object obj;
+    observable_storage::recorder recorder;
+    const auto subscription = obj.title.subscribe(
+        [&recorder](const std::string& old_value, const std::string& new_value) {
+            recorder.changes.emplace_back(old_value, new_value);
+        });
+    ASSERT_TRUE(subscription.has_value());
+    obj.title = "first";
+    obj.title = std::string { "second" };
+    ASSERT_EQ (2u, recorder.changes.size());
+    ASSERT_EQ ("", recorder.changes[0].first);
+    ASSERT_EQ ("first", recorder.changes[0].second);
+    ASSERT_EQ ("first", recorder.changes[1].first);
+    ASSERT_EQ ("second", recorder.changes[1].second);
+
+    obj.title.unsubscribe(*subscription);
+    obj.title = "third";
+    ASSERT_EQ (2u, recorder.changes.size());
+    ASSERT_EQ ("third", obj.title.get());
+}
+
+TEST(property_observable_testing, capacity_test)
+{
+    observable_storage::dummy_object obj;
+    int last_revision = 0;
+    auto subscriber = [&last_revision](int, int value) { last_revision = value; };
+    ASSERT_TRUE(obj.revision.subscribe(subscriber).has_value());
+    ASSERT_FALSE(obj.revision.subscribe(subscriber).has_value());
+    obj.bump();
+    obj.bump();
+    ASSERT_EQ (2, last_revision);
+}
+
+TEST(property_observable_testing, copy_test)
+{
+    observable_storage::dummy_object obj;
+    int notifications = 0;
+    (void)obj.title.subscribe([&notifications](const auto&, const auto&) { ++notifications; });
+    obj.title = "original";
+    auto copy { obj };
+    copy.title = "copy";
+    ASSERT_EQ (1, notifications);
+    ASSERT_EQ ("original", obj.title.get());
+    ASSERT_EQ ("copy", copy.title.get());
+}
+
+TEST(property_observable_testing, batch_test)
+{
+    observable_storage::dummy_object obj;
+    observable_storage::recorder recorder;
+    int revisions = 0;
+    (void)obj.title.subscribe(
+        [&recorder](const std::string& old_value, const std::string& new_value) {
+            recorder.changes.emplace_back(old_value, new_value);
+        });
+    (void)obj.revision.subscribe([&revisions](int, int) { ++revisions; });
+    obj.title = "initial";
+    {
+        util::property_batch batch;
+        obj.title = "first";
+        obj.bump();
+        {
+            util::property_batch nested;
+            obj.title = "second";
+            obj.bump();
+        }
+        ASSERT_EQ (1u, recorder.changes.size());
+        ASSERT_EQ (0, revisions);
+        obj.title = "final";
+    }
+    ASSERT_EQ (2u, recorder.changes.size());
+    ASSERT_EQ ("initial", recorder.changes[1].first);
+    ASSERT_EQ ("final", recorder.changes[1].second);
+    ASSERT_EQ (1, revisions);
+    ASSERT_EQ (2, obj.revision.get());
+}
+
+TEST(property_observable_testing, batch_destroyed_property_test)
+{
+    int notifications = 0;
+    util::property_batch batch;
+    {
+        observable_storage::dummy_object obj;
+        (void)obj.title.subscribe([&notifications](const auto&, const auto&) { ++notifications; });
+        obj.title = std::string(128, 'x');
+    }
+    ASSERT_EQ (0, notifications);
+}
+
+TEST(property_observable_testing, batch_moved_property_test)
+{
+    observable_storage::recorder recorder;
+    std::vector<observable_storage::dummy_object> objects(1);
+    (void)objects[0].title.subscribe(
+        [&recorder](const std::string& old_value, const std::string& new_value) {
+            recorder.changes.emplace_back(old_value, new_value);
+        });
+    {
+        util::property_batch batch;
+        objects[0].title = "first";
+
+        // The reallocation moves the owner with its pending change.
+        objects.resize(objects.capacity() + 1);
+        objects[0].title = "second";
+        ASSERT_TRUE(recorder.changes.empty());
+    }
+    ASSERT_EQ (1u, recorder.changes.size());
+    ASSERT_EQ ("", recorder.changes[0].first);
+    ASSERT_EQ ("second", recorder.changes[0].second);
+
+    auto moved { std::move(objects[0]) };
+    moved.title = "third";
+    objects[0].title = "moved from";
+    ASSERT_EQ (2u, recorder.changes.size());
+    ASSERT_EQ ("third", recorder.changes[1].second);
+}
+
+TEST(property_observable_testing, batch_commit_test)
+{
+    observable_storage::dummy_object first;
+    observable_storage::dummy_object second;
+    int notifications = 0;
+    (void)first.title.subscribe([](const auto&, const std::string& title) {
+        if (title == "throw")
+        {
+            throw std::runtime_error { "subscriber" };
+        }
+    });
+    (void)second.title.subscribe([&notifications](const auto&, const auto&) { ++notifications; });
+
+    // commit rethrows, after every changed property is notified.
+    {
+        util::property_batch batch;
+        first.title = "throw";
+        second.title = "second";
+        ASSERT_THROW(batch.commit(), std::runtime_error);
+        ASSERT_EQ (1, notifications);
+        batch.commit();
+    }
+
+    // The destructor ignores the exception.
+    {
+        util::property_batch batch;
+        first.title = "ok";
+        first.title = "throw";
+        second.title = "again";
+    }
+    ASSERT_EQ (2, notifications);
+
+    // The batches work after the exceptions.
+    {
+        util::property_batch batch;
+        first.title = "ok";
+        second.title = "last";
+        batch.commit();
+    }
+    ASSERT_EQ (3, notifications);
+}
+
+TEST(property_observable_testing, batch_destroyed_on_other_thread_test)
+{
+    // The property written in the batch of this thread is destroyed on another one.
+    int notifications = 0;
+    util::property_batch batch;
+    auto obj = std::make_unique<observable_storage::dummy_object>();
+    (void)obj->title.subscribe([&notifications](const auto&, const auto&) { ++notifications; });
+    obj->title = std::string(128, 'x');
+    std::thread { [&obj] { obj.reset(); } }.join();
+    batch.commit();
+    ASSERT_EQ (0, notifications);
+}
@@ -0,0 +1,206 @@
+/**
+ * @file        property_polymorphic.cc
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Unit tests of the polymorphic storage policy.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#include <array>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "property_polymorphic.h"
+
+namespace polymorphism
+{
+struct strategy
+{
+    virtual ~strategy() = default;
+    virtual int next(int value) const = 0;
+    virtual void tune(int) { }
+};
+
+struct increment : strategy
+{
+    explicit increment(int step = 1) : step { step } { }
+    int next(int value) const override { return value + step; }
+    void tune(int new_step) override { step = new_step; }
+    int step;
+};
+
+struct lookup : strategy
+{
+    lookup()
+    {
+        for (int i = 0; i < int(table.size()); ++i)
+        {
+            table[i] = i * i;
+        }
+    }
+
+    int next(int value) const override { return table[value % table.size()]; }
+    std::array<int, 64> table {};
+};
+
+/*
+ * Counts the live objects, to check that every object is destroyed once.
+ */
+struct counted : strategy
+{
+    static inline int alive = 0;
+    counted() { ++alive; }
+    counted(const counted&) { ++alive; }
+    ~counted() override { --alive; }
+    int next(int value) const override { return -value; }
+};
+
+/*
+ * Built from another strategy, to construct from the replaced object.
+ */
+struct shifted : strategy
+{
+    explicit shifted(const strategy& inner) : offset { inner.next(0) } { }
+    int next(int value) const override { return value + offset; }
+    int offset;
+};
+
+template <class TBase>
+struct failing : TBase
+{
+    failing() { throw std::runtime_error { "failing" }; }
+};
+
+struct unit
+{
+    template <class TAccess = util::public_get_set>
+    using property_t = util::property<unit, strategy, TAccess, util::polymorphic<16>>;
+
+    property_t<> behaviour { increment { 2 } };
+    property_t<util::public_get> fallback { std::in_place_type<lookup> };
+
+    void reset_fallback()
+    {
+        fallback = increment {};
+    }
+};
+}
+
+TEST(property_polymorphic_testing, storage_test)
+{
+    polymorphism::unit u;
+    ASSERT_TRUE(u.behaviour.is_inline());
+    ASSERT_FALSE(u.fallback.is_inline());
+    ASSERT_EQ (7, u.behaviour->next(5));
+    ASSERT_EQ (25, u.fallback.get().next(5));
+
+    u.behaviour->tune(10);
+    ASSERT_EQ (15, static_cast<polymorphism::strategy&>(u.behaviour).next(5));
+
+    // The copies are deep.
+    polymorphism::unit copy = u;
+    copy.behaviour->tune(1);
+    ASSERT_EQ (15, u.behaviour->next(5));
+    ASSERT_EQ (6, copy.behaviour->next(5));
+    ASSERT_EQ (36, copy.fallback->next(6));
+
+    // The inline and the arena objects replace each other.
+    copy.behaviour.emplace<polymorphism::lookup>();
+    ASSERT_FALSE(copy.behaviour.is_inline());
+    ASSERT_EQ (9, copy.behaviour->next(3));
+    copy.reset_fallback();
+    ASSERT_TRUE(copy.fallback.is_inline());
+    ASSERT_EQ (4, copy.fallback->next(3));
+
+    // The moved from property is empty.
+    polymorphism::unit moved = std::move(copy);
+    ASSERT_FALSE(copy.behaviour.has_value());
+    ASSERT_FALSE(copy.fallback.has_value());
+    ASSERT_EQ (9, moved.behaviour->next(3));
+    ASSERT_EQ (4, moved.fallback->next(3));
+    copy = moved;
+    ASSERT_EQ (9, copy.behaviour->next(3));
+}
+
+TEST(property_polymorphic_testing, arena_test)
+{
+    using property_t = util::property<polymorphism::unit, polymorphism::strategy,
+                                      util::public_get_set, util::polymorphic<16>>;
+
+    std::array<std::byte, 64 * 1024> buffer;
+    std::pmr::monotonic_buffer_resource arena { buffer.data(), buffer.size(),
+                                                std::pmr::null_memory_resource() };
+    {
+        std::vector<property_t> strategies;
+        for (int i = 0; i < 100; ++i)
+        {
+            strategies.emplace_back(arena, std::in_place_type<polymorphism::lookup>);
+        }
+        for (const auto& s : strategies)
+        {
+            ASSERT_FALSE(s.is_inline());
+            const auto* address = reinterpret_cast<const std::byte*>(&s.get());
+            ASSERT_TRUE(address >= buffer.data() && address < buffer.data() + buffer.size());
+        }
+
+        // The copy allocates in the arena of the source.
+        property_t copy = strategies[0];
+        const auto* address = reinterpret_cast<const std::byte*>(&copy.get());
+        ASSERT_TRUE(address >= buffer.data() && address < buffer.data() + buffer.size());
+        ASSERT_EQ (16, copy->next(4));
+    }
+
+    // The small objects do not touch the arena.
+    std::pmr::monotonic_buffer_resource empty { std::pmr::null_memory_resource() };
+    property_t small { empty, std::in_place_type<polymorphism::increment>, 3 };
+    ASSERT_EQ (4, small->next(1));
+}
+
+TEST(property_polymorphic_testing, replacement_test)
+{
+    using property_t = util::property<polymorphism::unit, polymorphism::strategy,
+                                      util::public_get_set, util::polymorphic<16>>;
+
+    // The new object is built from the old one, which is alive until then.
+    property_t inline_property { polymorphism::increment { 2 } };
+    inline_property.emplace<polymorphism::shifted>(inline_property.get());
+    ASSERT_TRUE(inline_property.is_inline());
+    ASSERT_EQ (3, inline_property->next(1));
+    inline_property = static_cast<const polymorphism::shifted&>(inline_property.get());
+    ASSERT_EQ (3, inline_property->next(1));
+
+    property_t arena_property { std::in_place_type<polymorphism::lookup> };
+    arena_property = static_cast<const polymorphism::lookup&>(arena_property.get());
+    ASSERT_FALSE(arena_property.is_inline());
+    ASSERT_EQ (25, arena_property->next(5));
+
+    // The old object is kept if the constructor throws.
+    ASSERT_THROW(inline_property.emplace<polymorphism::failing<polymorphism::increment>>(),
+                 std::runtime_error);
+    ASSERT_EQ (3, inline_property->next(1));
+    ASSERT_THROW(arena_property.emplace<polymorphism::failing<polymorphism::lookup>>(),
+                 std::runtime_error);
+    ASSERT_EQ (25, arena_property->next(5));
+}
+
+TEST(property_polymorphic_testing, lifetime_test)
+{
+    using property_t = util::property<polymorphism::unit, polymorphism::strategy,
+                                      util::public_get_set, util::polymorphic<>>;
+    {
+        property_t first { polymorphism::counted {} };
+        property_t second = first;
+        ASSERT_EQ (2, polymorphism::counted::alive);
+        second = polymorphism::increment {};
+        ASSERT_EQ (1, polymorphism::counted::alive);
+        second = first;
+        first = std::move(second);
+        ASSERT_EQ (1, polymorphism::counted::alive);
+        ASSERT_EQ (-3, first->next(3));
+    }
+    ASSERT_EQ (0, polymorphism::counted::alive);
+}
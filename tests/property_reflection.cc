@@ -0,0 +1,101 @@
+/**
+ * @file        property_reflection.cc
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Unit tests of the compile-time property lists.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "property_reflection.h"
+
+namespace reflection
+{
+struct dummy_object
+{
+    template <class ... TArgs>
+    using property_t = util::property<dummy_object, TArgs...>;
+
+    property_t<int, util::public_get_set> health { 100 };
+    property_t<std::string, util::public_get> name { "dummy" };
+    property_t<double, util::public_get_set> speed { 1.5 };
+
+    using properties = util::property_list<
+        util::member<"health", &dummy_object::health>,
+        util::member<"name", &dummy_object::name>,
+        util::member<"speed", &dummy_object::speed>>;
+};
+
+struct external_object
+{
+    util::property<external_object, int, util::public_get_set> id;
+};
+}
+
+template <>
+struct util::reflect<reflection::external_object>
+{
+    using type = util::property_list<util::member<"id", &reflection::external_object::id>>;
+};
+
+TEST(property_reflection_testing, descriptor_test)
+{
+    using object = reflection::dummy_object;
+    static_assert(util::reflectable<object>);
+    static_assert(!util::reflectable<int>);
+    static_assert(util::property_count<object> == 3);
+    static_assert(util::index_of<object, "name"> == 1);
+    static_assert(util::index_of<object, "missing"> == 3);
+    static_assert(std::is_same_v<util::member_at<object, 2>::value_type, double>);
+    static_assert(std::is_same_v<util::member_at<object, 1>::access_policy, util::public_get>);
+    static_assert(util::member_at<object, 0>::name == "health");
+    static_assert(util::property_count<reflection::external_object> == 1);
+
+    std::vector<std::string> names;
+    util::for_each_member<object>([&](auto member) { names.emplace_back(member.name); });
+    ASSERT_EQ ((std::vector<std::string> { "health", "name", "speed" }), names);
+}
+
+TEST(property_reflection_testing, visit_test)
+{
+    reflection::dummy_object obj;
+    std::string text;
+    util::for_each_property(obj, [&](auto member, auto& property)
+    {
+        using value_type = typename decltype(member)::value_type;
+        const value_type& value = property;
+        if constexpr (std::is_same_v<value_type, std::string>)
+        {
+            text += std::string { member.name } + "=" + value + ";";
+        }
+        else
+        {
+            text += std::string { member.name } + "=" + std::to_string(value) + ";";
+        }
+    });
+    ASSERT_EQ ("health=100;name=dummy;speed=1.500000;", text);
+
+    util::for_each_property(obj, [](auto member, auto& property)
+    {
+        if constexpr (util::impl::is_public_set<typename decltype(member)::access_policy>)
+        {
+            property = 0;
+        }
+    });
+    ASSERT_EQ (0, static_cast<int>(obj.health));
+    ASSERT_EQ (0.0, static_cast<double>(obj.speed));
+
+    util::get_property<"health">(obj) = 42;
+    ASSERT_EQ (42, static_cast<int>(obj.health));
+    const auto& const_obj = obj;
+    static_assert(std::is_const_v<std::remove_reference_t<
+        decltype(util::get_property<"name">(const_obj))>>);
+
+    reflection::external_object external;
+    util::get_property<"id">(external) = 7;
+    ASSERT_EQ (7, static_cast<int>(external.id));
+}
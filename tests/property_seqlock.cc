@@ -0,0 +1,122 @@
+/**
+ * @file        property_seqlock.cc
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Unit tests of the seqlock storage policy.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "property_seqlock.h"
+
+namespace seqlock_storage
+{
+struct quote
+{
+    long bid;
+    long ask;
+    long bid_size;
+    long ask_size;
+    long time;
+    char venue[3];
+};
+
+struct dummy_object
+{
+    util::property<dummy_object, quote, util::public_get, util::seqlock> last;
+    util::property<dummy_object, quote, util::public_get_set, util::seqlock> shared;
+
+    void on_tick(long value)
+    {
+        last = quote { value, value, value, value, value, { 'A', 'B', 'C' } };
+    }
+
+    void bump()
+    {
+        last.update([](quote& q) { ++q.time; });
+    }
+};
+
+template <typename T>
+constexpr bool is_public_store = requires(T property, quote value)
+{
+    property.store(value);
+};
+}
+
+TEST(property_seqlock_testing, access_test)
+{
+    using object = seqlock_storage::dummy_object;
+    ASSERT_FALSE(seqlock_storage::is_public_store<decltype(object::last)>);
+    ASSERT_TRUE(seqlock_storage::is_public_store<decltype(object::shared)>);
+}
+
+TEST(property_seqlock_testing, value_test)
+{
+    seqlock_storage::dummy_object obj;
+    obj.on_tick(7);
+    obj.bump();
+    const seqlock_storage::quote value = obj.last;
+    ASSERT_EQ (7, value.bid);
+    ASSERT_EQ (8, value.time);
+    ASSERT_EQ ('C', value.venue[2]);
+
+    obj.shared.store(value);
+    auto copy { obj };
+    ASSERT_EQ (8, copy.shared.load().time);
+}
+
+TEST(property_seqlock_testing, throwing_update_test)
+{
+    seqlock_storage::dummy_object obj;
+    obj.shared.store(seqlock_storage::quote { 1, 2, 3, 4, 5, { 'A', 'B', 'C' } });
+    ASSERT_THROW(obj.shared.update([](seqlock_storage::quote& q)
+    {
+        q.time = 100;
+        throw std::runtime_error { "rejected" };
+    }), std::runtime_error);
+
+    // The value is not changed and the lock is released.
+    ASSERT_EQ (5, obj.shared.load().time);
+    obj.shared.update([](seqlock_storage::quote& q) { ++q.time; });
+    ASSERT_EQ (6, obj.shared.load().time);
+}
+
+TEST(property_seqlock_testing, concurrent_test)
+{
+    seqlock_storage::dummy_object obj;
+    std::atomic<bool> done { false };
+    std::vector<std::thread> readers;
+    std::atomic<int> torn_reads { 0 };
+    for (int i = 0; i < 3; ++i)
+    {
+        readers.emplace_back([&] {
+            while (!done.load())
+            {
+                const auto value = obj.last.load();
+                if (value.bid != value.ask || value.bid != value.bid_size
+                    || value.bid != value.ask_size || value.bid != value.time)
+                {
+                    ++torn_reads;
+                }
+            }
+        });
+    }
+    for (long i = 0; i < 100000; ++i)
+    {
+        obj.on_tick(i);
+    }
+    done = true;
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+    ASSERT_EQ (0, torn_reads.load());
+    ASSERT_EQ (99999, obj.last.load().time);
+}
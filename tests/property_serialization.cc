@@ -0,0 +1,183 @@
+/**
+ * @file        property_serialization.cc
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Unit tests of the binary serialization of the owners.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "property_serialization.h"
+
+namespace serialization
+{
+struct point
+{
+    template <class ... TArgs>
+    using property_t = util::property<point, TArgs...>;
+
+    property_t<double, util::public_get_set> x;
+    property_t<double, util::public_get_set> y;
+    property_t<std::int64_t> hidden;
+
+    using properties = util::property_list<
+        util::member<"x", &point::x>,
+        util::member<"y", &point::y>,
+        util::member<"hidden", &point::hidden>>;
+
+    void set_hidden(std::int64_t value)
+    {
+        hidden = value;
+    }
+
+    std::int64_t get_hidden()
+    {
+        return hidden;
+    }
+};
+
+/*
+ * Has the padding after the flag.
+ */
+struct padded
+{
+    util::property<padded, char, util::public_get_set> flag;
+    util::property<padded, double, util::public_get_set> value;
+
+    using properties = util::property_list<
+        util::member<"flag", &padded::flag>,
+        util::member<"value", &padded::value>>;
+};
+
+/*
+ * Has the member, which is not listed.
+ */
+struct partial
+{
+    util::property<partial, int, util::public_get_set> listed;
+    int cache = 0;
+
+    using properties = util::property_list<util::member<"listed", &partial::listed>>;
+};
+
+struct document
+{
+    template <class ... TArgs>
+    using property_t = util::property<document, TArgs...>;
+
+    property_t<int, util::public_get_set> id;
+    property_t<std::string, util::public_get_set> title;
+    property_t<std::vector<int>, util::public_get_set> pages;
+    property_t<std::vector<std::string>, util::public_get_set> tags;
+    property_t<float, util::public_get> rank;
+
+    using properties = util::property_list<
+        util::member<"id", &document::id>,
+        util::member<"title", &document::title>,
+        util::member<"pages", &document::pages>,
+        util::member<"tags", &document::tags>,
+        util::member<"rank", &document::rank>>;
+
+    void set_rank(float value)
+    {
+        rank = value;
+    }
+};
+}
+
+TEST(property_serialization_testing, trivial_test)
+{
+    using serialization::point;
+    static_assert(util::is_trivially_serializable<point>);
+
+    point source;
+    source.x = 1.5;
+    source.y = -2.0;
+    source.set_hidden(7);
+    ASSERT_EQ (sizeof(point), util::serialized_size(source));
+
+    std::array<std::byte, sizeof(point)> buffer {};
+    ASSERT_EQ (sizeof(point), util::serialize(source, buffer));
+    ASSERT_EQ (0u, util::serialize(source, std::span { buffer }.first(sizeof(point) - 1)));
+
+    point target;
+    ASSERT_EQ (sizeof(point), util::deserialize(target, buffer));
+    ASSERT_EQ (1.5, static_cast<double>(target.x));
+    ASSERT_EQ (-2.0, static_cast<double>(target.y));
+    ASSERT_EQ (7, target.get_hidden());
+    ASSERT_EQ (0u, util::deserialize(target, std::span { buffer }.first(3)));
+}
+
+TEST(property_serialization_testing, padding_test)
+{
+    // The owners with the padding or the unlisted members are written field by field.
+    static_assert(!util::is_trivially_serializable<serialization::padded>);
+    static_assert(!util::is_trivially_serializable<serialization::partial>);
+
+    serialization::padded source;
+    source.flag = 'a';
+    source.value = 2.5;
+    ASSERT_EQ (sizeof(char) + sizeof(double), util::serialized_size(source));
+    std::array<std::byte, sizeof(char) + sizeof(double)> buffer {};
+    ASSERT_EQ (buffer.size(), util::serialize(source, buffer));
+
+    serialization::padded target;
+    ASSERT_EQ (buffer.size(), util::deserialize(target, buffer));
+    ASSERT_EQ ('a', static_cast<char>(target.flag));
+    ASSERT_EQ (2.5, static_cast<double>(target.value));
+
+    serialization::partial first;
+    first.listed = 5;
+    first.cache = 9;
+    std::array<std::byte, sizeof(int)> small {};
+    ASSERT_EQ (sizeof(int), util::serialize(first, small));
+    serialization::partial second;
+    ASSERT_EQ (sizeof(int), util::deserialize(second, small));
+    ASSERT_EQ (5, static_cast<int>(second.listed));
+    ASSERT_EQ (0, second.cache);
+}
+
+TEST(property_serialization_testing, field_test)
+{
+    using serialization::document;
+    static_assert(!util::is_trivially_serializable<document>);
+
+    document source;
+    source.id = 42;
+    source.title = "report";
+    source.pages = std::vector { 1, 2, 3 };
+    source.tags = std::vector<std::string> { "a", "", "long tag" };
+    source.set_rank(0.5f);
+
+    const auto size = util::serialized_size(source);
+    ASSERT_EQ (4u + (8 + 6) + (8 + 12) + (8 + (8 + 1) + (8 + 0) + (8 + 8)) + 4, size);
+    std::vector<std::byte> buffer(size);
+    ASSERT_EQ (size, util::serialize(source, buffer));
+
+    document target;
+    ASSERT_EQ (size, util::deserialize(target, buffer));
+    ASSERT_EQ (42, static_cast<int>(target.id));
+    ASSERT_EQ ("report", static_cast<std::string&>(target.title));
+    ASSERT_EQ ((std::vector { 1, 2, 3 }), static_cast<std::vector<int>&>(target.pages));
+    ASSERT_EQ ((std::vector<std::string> { "a", "", "long tag" }),
+               static_cast<std::vector<std::string>&>(target.tags));
+    ASSERT_EQ (0.5f, static_cast<const float&>(target.rank));
+
+    for (std::size_t truncated = 0; truncated < size; ++truncated)
+    {
+        ASSERT_EQ (0u, util::serialize(source, std::span { buffer }.first(truncated)));
+        ASSERT_EQ (0u, util::deserialize(target, std::span { buffer }.first(truncated)));
+    }
+
+    // A corrupted length does not allocate.
+    std::vector<std::byte> corrupted { buffer.begin(), buffer.begin() + 12 };
+    corrupted[4] = std::byte { 0xff };
+    corrupted[11] = std::byte { 0x7f };
+    ASSERT_EQ (0u, util::deserialize(target, corrupted));
+}
@@ -0,0 +1,86 @@
+/**
+ * @file        property_sharded.cc
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Unit tests of the sharded storage policy.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "property_sharded.h"
+
+namespace sharded_storage
+{
+struct dummy_object
+{
+    util::property<dummy_object, long, util::public_get, util::sharded<4>> requests;
+    util::property<dummy_object, unsigned, util::public_get_set, util::sharded<>> shared;
+
+    void on_request()
+    {
+        ++requests;
+    }
+
+    void clear()
+    {
+        requests.reset();
+    }
+};
+
+template <typename T>
+constexpr bool is_public_write = requires(T property)
+{
+    property.add(1);
+};
+}
+
+TEST(property_sharded_testing, access_test)
+{
+    using object = sharded_storage::dummy_object;
+    ASSERT_FALSE(sharded_storage::is_public_write<decltype(object::requests)>);
+    ASSERT_TRUE(sharded_storage::is_public_write<decltype(object::shared)>);
+}
+
+TEST(property_sharded_testing, value_test)
+{
+    sharded_storage::dummy_object obj;
+    obj.on_request();
+    obj.on_request();
+    ASSERT_EQ (2, obj.requests.load());
+    obj.shared = 10u;
+    obj.shared -= 3u;
+    obj.shared--;
+    ASSERT_EQ (6u, static_cast<unsigned>(obj.shared));
+    auto copy { obj };
+    ASSERT_EQ (2, copy.requests.load());
+    obj.clear();
+    ASSERT_EQ (0, obj.requests.load());
+}
+
+TEST(property_sharded_testing, concurrent_test)
+{
+    constexpr int thread_count = 8;
+    constexpr int iteration_count = 10000;
+    sharded_storage::dummy_object obj;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < thread_count; ++i)
+    {
+        threads.emplace_back([&obj] {
+            for (int j = 0; j < iteration_count; ++j)
+            {
+                obj.on_request();
+                obj.shared++;
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    ASSERT_EQ (thread_count * iteration_count, obj.requests.load());
+    ASSERT_EQ (unsigned { thread_count * iteration_count }, obj.shared.load());
+}
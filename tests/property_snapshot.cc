@@ -0,0 +1,175 @@
+/**
+ * @file        property_snapshot.cc
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Unit tests of the snapshot storage policy.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#include <atomic>
+#include <latch>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "property_snapshot.h"
+
+namespace snapshot_storage
+{
+using routing_table = std::map<std::string, int>;
+
+struct dummy_object
+{
+    util::property<dummy_object, routing_table, util::public_get, util::snapshot> routes;
+    util::property<dummy_object, std::string, util::public_get_set, util::snapshot> name;
+
+    void add_route(const std::string& path, int target)
+    {
+        routes.update([&](routing_table& table) { table[path] = target; });
+    }
+};
+
+template <typename T>
+constexpr bool is_public_store = requires(T property)
+{
+    property.store({});
+};
+}
+
+TEST(property_snapshot_testing, access_test)
+{
+    using object = snapshot_storage::dummy_object;
+    ASSERT_FALSE(snapshot_storage::is_public_store<decltype(object::routes)>);
+    ASSERT_TRUE(snapshot_storage::is_public_store<decltype(object::name)>);
+}
+
+TEST(property_snapshot_testing, value_test)
+{
+    snapshot_storage::dummy_object obj;
+    {
+        const auto empty = obj.routes.get();
+        obj.add_route("/a", 1);
+        obj.add_route("/b", 2);
+
+        // The guard keeps its version alive.
+        ASSERT_TRUE(empty->empty());
+        ASSERT_EQ (2u, obj.routes.get()->size());
+        ASSERT_EQ (2u, obj.routes.retired_count());
+    }
+
+    // The next write frees the versions no guard can see.
+    obj.add_route("/c", 3);
+    ASSERT_EQ (0u, obj.routes.retired_count());
+
+    obj.name = "router";
+    auto copy { obj };
+    ASSERT_EQ ("router", copy.name.get().get());
+    ASSERT_EQ (2, copy.routes.get()->at("/b"));
+}
+
+TEST(property_snapshot_testing, bounded_test)
+{
+    snapshot_storage::dummy_object obj;
+    for (int i = 0; i < 10000; ++i)
+    {
+        obj.name = std::to_string(i);
+    }
+    ASSERT_EQ (0u, obj.name.retired_count());
+    ASSERT_EQ ("9999", *obj.name.get());
+}
+
+TEST(property_snapshot_testing, collect_test)
+{
+    snapshot_storage::dummy_object obj;
+    {
+        const auto initial = obj.name.get();
+        obj.name = "router";
+        ASSERT_EQ (1u, obj.name.retired_count());
+    }
+
+    // The writes to the other properties free the versions too.
+    obj.add_route("/a", 1);
+    ASSERT_EQ (0u, obj.name.retired_count());
+    ASSERT_EQ (0u, obj.routes.retired_count());
+
+    {
+        const auto current = obj.name.get();
+        obj.name = "proxy";
+    }
+    util::collect_snapshots();
+    ASSERT_EQ (0u, obj.name.retired_count());
+    ASSERT_EQ ("proxy", *obj.name.get());
+}
+
+TEST(property_snapshot_testing, many_readers_test)
+{
+    constexpr std::ptrdiff_t reader_count = 200;
+    snapshot_storage::dummy_object obj;
+    obj.name = "initial";
+    std::latch entered { reader_count };
+    std::latch written { 1 };
+    std::atomic<int> stale_reads { 0 };
+    std::vector<std::thread> readers;
+    for (std::ptrdiff_t t = 0; t < reader_count; ++t)
+    {
+        readers.emplace_back([&] {
+            const auto name = obj.name.get();
+            entered.count_down();
+            written.wait();
+            if (*name != "initial")
+            {
+                ++stale_reads;
+            }
+        });
+    }
+    entered.wait();
+    obj.name = "next";
+
+    // Every reader has its own slot, so the held version is not freed.
+    ASSERT_EQ (1u, obj.name.retired_count());
+    written.count_down();
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+    util::collect_snapshots();
+    ASSERT_EQ (0, stale_reads.load());
+    ASSERT_EQ (0u, obj.name.retired_count());
+}
+
+TEST(property_snapshot_testing, concurrent_test)
+{
+    snapshot_storage::dummy_object obj;
+    std::atomic<bool> done { false };
+    std::atomic<int> inconsistent_reads { 0 };
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 3; ++t)
+    {
+        readers.emplace_back([&] {
+            while (!done.load())
+            {
+                const auto table = obj.routes.get();
+                if (!table->empty() && table->size() != table->rbegin()->second + 1u)
+                {
+                    ++inconsistent_reads;
+                }
+            }
+        });
+    }
+    for (int i = 0; i < 1000; ++i)
+    {
+        obj.add_route(std::to_string(100000 + i), i);
+    }
+    done = true;
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+    obj.add_route(std::to_string(101000), 1000);
+    ASSERT_EQ (0, inconsistent_reads.load());
+    ASSERT_EQ (1001u, obj.routes.get()->size());
+    ASSERT_EQ (0u, obj.routes.retired_count());
+}
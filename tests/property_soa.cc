@@ -0,0 +1,268 @@
+/**
+ * @file        property_soa.cc
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Unit tests of the struct-of-arrays container.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "property_soa.h"
+
+namespace soa
+{
+struct particle
+{
+    template <class ... TArgs>
+    using property_t = util::property<particle, TArgs...>;
+
+    property_t<float, util::public_get_set> x;
+    property_t<double, util::public_get> mass { 1.0 };
+    property_t<bool, util::public_get_set> alive { true };
+    property_t<std::string> tag;
+
+    using properties = util::property_list<
+        util::member<"x", &particle::x>,
+        util::member<"mass", &particle::mass>,
+        util::member<"alive", &particle::alive>,
+        util::member<"tag", &particle::tag>>;
+
+    particle() = default;
+
+    particle(float x_value, double mass_value, std::string tag_value)
+        : x { x_value }
+        , mass { mass_value }
+        , tag { std::move(tag_value) }
+    {
+    }
+
+    static void set_mass(util::soa_vector<particle>& particles, std::size_t index, double value)
+    {
+        particles[index].get<"mass">() = value;
+    }
+
+    static std::string tags(util::soa_vector<particle>& particles)
+    {
+        std::string result;
+        for (const auto& tag : particles.column<"tag">())
+        {
+            result += tag;
+        }
+        return result;
+    }
+
+    static std::string tag_at(const util::soa_vector<particle>& particles, std::size_t index)
+    {
+        return particles[index].get<"tag">();
+    }
+
+    std::string get_tag()
+    {
+        return tag;
+    }
+};
+
+/*
+ * The owner without the listed properties.
+ */
+struct marker
+{
+    using properties = util::property_list<>;
+};
+
+/*
+ * The value, whose copy throws on demand.
+ */
+struct fragile
+{
+    static inline bool fail = false;
+
+    fragile() = default;
+    explicit fragile(int new_value) : value { new_value } { }
+    fragile(const fragile& other) : value { other.value } { check(); }
+    fragile(fragile&&) noexcept = default;
+    fragile& operator=(fragile&&) noexcept = default;
+
+    fragile& operator=(const fragile& other)
+    {
+        check();
+        value = other.value;
+        return *this;
+    }
+
+    static void check()
+    {
+        if (fail)
+        {
+            throw std::runtime_error { "fragile" };
+        }
+    }
+
+    int value = 0;
+};
+
+struct record
+{
+    template <class T>
+    using property_t = util::property<record, T, util::public_get_set>;
+
+    property_t<int> id;
+    property_t<fragile> payload;
+
+    using properties = util::property_list<
+        util::member<"id", &record::id>,
+        util::member<"payload", &record::payload>>;
+};
+
+template <typename T, typename TValue>
+constexpr bool is_public_get = requires(T reference)
+{
+    static_cast<const TValue&>(reference);
+};
+
+template <typename T>
+constexpr bool is_public_set = requires(T reference)
+{
+    reference = {};
+};
+
+template <util::fixed_string TName>
+constexpr bool has_public_column = requires(util::soa_vector<particle>& particles)
+{
+    particles.template column<TName>();
+};
+
+template <util::fixed_string TName>
+constexpr bool has_writable_column = requires(util::soa_vector<particle>& particles)
+{
+    particles.template column<TName>()[0] = {};
+};
+}
+
+TEST(property_soa_testing, access_test)
+{
+    using soa::particle;
+    util::soa_vector<particle> particles;
+    particles.emplace_back();
+    ASSERT_TRUE(soa::is_public_set<decltype(particles[0].get<"x">())>);
+    ASSERT_FALSE(soa::is_public_set<decltype(particles[0].get<"mass">())>);
+    ASSERT_FALSE(soa::is_public_set<decltype(particles[0].get<"tag">())>);
+    ASSERT_TRUE(soa::has_public_column<"x">);
+    ASSERT_TRUE(soa::has_public_column<"mass">);
+    ASSERT_FALSE(soa::has_public_column<"tag">);
+    ASSERT_TRUE(soa::has_writable_column<"x">);
+    ASSERT_FALSE(soa::has_writable_column<"mass">);
+}
+
+TEST(property_soa_testing, column_test)
+{
+    using soa::particle;
+    util::soa_vector<particle> particles;
+    ASSERT_TRUE(particles.empty());
+    for (int i = 0; i < 100; ++i)
+    {
+        particles.push_back(particle { static_cast<float>(i), 2.0, i < 2 ? "ab" : "" });
+    }
+    ASSERT_EQ (100u, particles.size());
+
+    for (float& x : particles.column<"x">())
+    {
+        x += 1.0f;
+    }
+    const auto xs = particles.column<"x">();
+    ASSERT_EQ (5050.0f, std::accumulate(xs.begin(), xs.end(), 0.0f));
+    const auto masses = particles.column<"mass">();
+    ASSERT_EQ (200.0, std::accumulate(masses.begin(), masses.end(), 0.0));
+    ASSERT_TRUE(particles.column<"alive">()[99]);
+
+    particles[3].get<"alive">() = false;
+    ASSERT_FALSE(particles.column<"alive">()[3]);
+    const float x = particles[3].get<"x">();
+    ASSERT_EQ (4.0f, x);
+
+    particle::set_mass(particles, 0, 5.0);
+    ASSERT_EQ (5.0, particles.column<"mass">()[0]);
+    ASSERT_EQ ("abab", particle::tags(particles));
+
+    particles.pop_back();
+    ASSERT_EQ (99u, particles.size());
+    particles.clear();
+    ASSERT_TRUE(particles.empty());
+}
+
+TEST(property_soa_testing, load_store_test)
+{
+    using soa::particle;
+    util::soa_vector<particle> particles;
+    particles.push_back(particle { 1.0f, 3.0, "first" });
+    particles.emplace_back();
+
+    auto loaded = particles.load(0);
+    ASSERT_EQ (1.0f, static_cast<float>(loaded.x));
+    ASSERT_EQ (3.0, static_cast<const double&>(loaded.mass));
+    ASSERT_EQ ("first", loaded.get_tag());
+
+    particles.store(1, loaded);
+    auto copy { particles };
+    ASSERT_EQ ("first", copy.load(1).get_tag());
+    ASSERT_EQ (3.0, copy.column<"mass">()[1]);
+}
+
+TEST(property_soa_testing, const_access_test)
+{
+    using soa::particle;
+    util::soa_vector<particle> particles;
+    particles.push_back(particle { 2.0f, 4.0, "const" });
+    const auto& view = particles;
+
+    const float x = view[0].get<"x">();
+    ASSERT_EQ (2.0f, x);
+    const double mass = view[0].get<"mass">();
+    ASSERT_EQ (4.0, mass);
+    ASSERT_EQ ("const", particle::tag_at(view, 0));
+    ASSERT_FALSE(soa::is_public_set<decltype(view[0].get<"x">())>);
+    ASSERT_TRUE((soa::is_public_get<decltype(view[0].get<"x">()), float>));
+    ASSERT_FALSE((soa::is_public_get<decltype(view[0].get<"tag">()), std::string>));
+}
+
+TEST(property_soa_testing, empty_list_test)
+{
+    util::soa_vector<soa::marker> markers;
+    ASSERT_TRUE(markers.empty());
+    markers.emplace_back();
+    markers.push_back(soa::marker {});
+    ASSERT_EQ (2u, markers.size());
+    markers.pop_back();
+    ASSERT_EQ (1u, markers.size());
+    markers.clear();
+    ASSERT_TRUE(markers.empty());
+}
+
+TEST(property_soa_testing, push_back_exception_test)
+{
+    util::soa_vector<soa::record> records;
+    soa::record row;
+    row.id = 1;
+    row.payload = soa::fragile { 10 };
+    records.push_back(row);
+
+    // The failed append leaves the columns as they were.
+    soa::fragile::fail = true;
+    row.id = 2;
+    ASSERT_THROW(records.push_back(row), std::runtime_error);
+    soa::fragile::fail = false;
+    ASSERT_EQ (1u, records.size());
+
+    row.id = 3;
+    row.payload = soa::fragile { 30 };
+    records.push_back(row);
+    ASSERT_EQ (2u, records.size());
+    ASSERT_EQ (3, records.column<"id">()[1]);
+    ASSERT_EQ (30, records.column<"payload">()[1].value);
+    ASSERT_EQ (3, static_cast<int>(records.load(1).id));
+}
@@ -0,0 +1,131 @@
+/**
+ * @file        property_tracked.cc
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Unit tests of the tracked storage policy.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "property_tracked.h"
+
+namespace tracked_storage
+{
+struct dummy_object
+{
+    template <class T, class TAccess, std::size_t I>
+    using property_t = util::property<dummy_object, T, TAccess, util::tracked<I>>;
+
+    util::dirty_set<70> dirty;
+    property_t<int, util::public_get_set, 0> health { dirty, 100 };
+    property_t<std::string, util::public_get, 1> name { dirty, std::in_place, 3, 'a' };
+    property_t<double, util::private_get_set, 69> secret { dirty };
+
+    void rename(std::string new_name)
+    {
+        name = std::move(new_name);
+    }
+
+    void hide(double value)
+    {
+        secret = value;
+    }
+};
+
+template <typename T>
+constexpr bool is_public_set = requires(T property)
+{
+    property = 1;
+};
+
+template <typename T>
+constexpr bool is_public_get = requires(const T property)
+{
+    property.get();
+};
+}
+
+TEST(property_tracked_testing, access_test)
+{
+    using object = tracked_storage::dummy_object;
+    ASSERT_TRUE(tracked_storage::is_public_set<decltype(object::health)>);
+    ASSERT_FALSE(tracked_storage::is_public_set<decltype(object::name)>);
+    ASSERT_FALSE(tracked_storage::is_public_set<decltype(object::secret)>);
+    ASSERT_TRUE(tracked_storage::is_public_get<decltype(object::name)>);
+    ASSERT_FALSE(tracked_storage::is_public_get<decltype(object::secret)>);
+}
+
+TEST(property_tracked_testing, write_test)
+{
+    tracked_storage::dummy_object obj;
+    ASSERT_FALSE(obj.dirty.any());
+    ASSERT_EQ (100, obj.health.get());
+    ASSERT_EQ ("aaa", obj.name.get());
+    ASSERT_FALSE(obj.dirty.any());
+
+    obj.health = 90;
+    ASSERT_TRUE(obj.dirty.test(0));
+    ASSERT_EQ (1u, obj.dirty.count());
+
+    obj.rename("bob");
+    obj.hide(1.5);
+    ASSERT_EQ ("bob", obj.name.get());
+    ASSERT_EQ (3u, obj.dirty.count());
+    ASSERT_TRUE(obj.dirty.test(69));
+
+    obj.dirty.clear();
+    int& health = obj.health;
+    ASSERT_TRUE(obj.dirty.test(0));
+    health = 80;
+    ASSERT_EQ (80, obj.health.get());
+}
+
+TEST(property_tracked_testing, iterate_test)
+{
+    tracked_storage::dummy_object obj;
+    obj.hide(2.0);
+    obj.health = 1;
+    obj.rename("x");
+
+    std::vector<std::size_t> indexes;
+    obj.dirty.for_each([&](std::size_t index) { indexes.push_back(index); });
+    ASSERT_EQ ((std::vector<std::size_t> { 0, 1, 69 }), indexes);
+    ASSERT_EQ (3u, obj.dirty.count());
+
+    indexes.clear();
+    obj.dirty.consume([&](std::size_t index) { indexes.push_back(index); });
+    ASSERT_EQ ((std::vector<std::size_t> { 0, 1, 69 }), indexes);
+    ASSERT_FALSE(obj.dirty.any());
+}
+
+TEST(property_tracked_testing, copy_test)
+{
+    tracked_storage::dummy_object obj;
+    obj.health = 5;
+    auto copy { obj };
+    ASSERT_TRUE(copy.dirty.test(0));
+    copy.dirty.clear();
+    obj.dirty.clear();
+
+    copy.rename("copy");
+    ASSERT_TRUE(copy.dirty.test(1));
+    ASSERT_FALSE(obj.dirty.any());
+    ASSERT_EQ ("aaa", obj.name.get());
+
+    obj = copy;
+    ASSERT_EQ ("copy", obj.name.get());
+    ASSERT_EQ (3u, obj.dirty.count());
+
+    // Only the owner copies the property, a standalone copy would keep the offset to a dirty_set,
+    // which is not there.
+    using object = tracked_storage::dummy_object;
+    ASSERT_FALSE(std::is_copy_constructible_v<decltype(object::health)>);
+    ASSERT_FALSE(std::is_move_constructible_v<decltype(object::health)>);
+    ASSERT_TRUE(std::is_copy_constructible_v<object>);
+    ASSERT_TRUE(std::is_move_constructible_v<object>);
+}
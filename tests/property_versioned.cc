@@ -0,0 +1,279 @@
+/**
+ * @file        property_versioned.cc
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Unit tests of the multi-version transactions and the versioned storage policy.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "property_versioned.h"
+
+namespace versioning
+{
+struct item
+{
+    template <class T, class TAccess = util::public_get_set>
+    using property_t = util::property<item, T, TAccess, util::versioned>;
+
+    property_t<double> price;
+    property_t<int> quantity { 10 };
+    property_t<std::string, util::public_get> name { std::in_place, 3, 'x' };
+
+    void rename(util::transaction& tx, const char* new_name)
+    {
+        name.set(tx, new_name);
+    }
+};
+}
+
+TEST(property_versioned_testing, snapshot_test)
+{
+    util::version_domain domain;
+    versioning::item first;
+    versioning::item second;
+
+    util::read_view before { domain };
+    ASSERT_EQ (0u, before.time());
+    ASSERT_EQ ("xxx", first.name.get(before));
+    {
+        util::transaction tx { domain };
+        first.price.set(tx, 2.5);
+        first.quantity.set(tx, first.quantity.get(tx) - 1);
+        first.quantity.set(tx, first.quantity.get(tx) - 1);
+        second.rename(tx, "second");
+        ASSERT_EQ (3u, tx.size());
+        ASSERT_EQ (8, first.quantity.get(tx));
+        ASSERT_EQ (10, first.quantity.get(before));
+        ASSERT_TRUE(tx.commit());
+    }
+    ASSERT_EQ (1u, domain.now());
+
+    // The old view does not see the commit.
+    ASSERT_EQ (0.0, first.price.get(before));
+    ASSERT_EQ (10, first.quantity.get(before));
+    ASSERT_EQ ("xxx", second.name.get(before));
+
+    util::read_view after { domain };
+    ASSERT_EQ (2.5, first.price.get(after));
+    ASSERT_EQ (8, first.quantity.get(after));
+    ASSERT_EQ ("second", second.name.get(after));
+
+    // The discarded writes are not visible.
+    {
+        util::transaction tx { domain };
+        first.price.set(tx, 100.0);
+    }
+    util::read_view last { domain };
+    ASSERT_EQ (2.5, first.price.get(last));
+    ASSERT_EQ (1u, domain.now());
+}
+
+TEST(property_versioned_testing, conflict_test)
+{
+    util::version_domain domain;
+    versioning::item shared;
+
+    util::transaction first { domain };
+    util::transaction second { domain };
+    shared.quantity.set(first, 5);
+    shared.quantity.set(second, 6);
+    shared.price.set(second, 1.0);
+    ASSERT_TRUE(first.commit());
+    ASSERT_FALSE(second.commit());
+    ASSERT_EQ (0u, second.size());
+
+    util::read_view view { domain };
+    ASSERT_EQ (5, shared.quantity.get(view));
+    ASSERT_EQ (0.0, shared.price.get(view));
+}
+
+TEST(property_versioned_testing, garbage_collection_test)
+{
+    util::version_domain domain;
+    versioning::item i;
+    const auto write = [&](int value)
+    {
+        util::transaction tx { domain };
+        i.quantity.set(tx, value);
+        ASSERT_TRUE(tx.commit());
+    };
+
+    write(1);
+    write(2);
+    ASSERT_EQ (1u, i.quantity.version_count());
+    {
+        util::read_view view { domain };
+        write(3);
+        write(4);
+
+        // The versions newer than the oldest view are kept until it is released.
+        ASSERT_EQ (3u, i.quantity.version_count());
+        ASSERT_EQ (2, i.quantity.get(view));
+    }
+    write(5);
+    ASSERT_EQ (1u, i.quantity.version_count());
+}
+
+TEST(property_versioned_testing, write_skew_test)
+{
+    // Both transactions keep the sum of the two balances non negative and write different
+    // properties, the second one fails, since the first one has written what it has read.
+    util::version_domain domain;
+    versioning::item account;
+    const auto withdraw = [&](util::transaction& tx, auto& balance)
+    {
+        if (account.price.get(tx) + account.quantity.get(tx) >= 10)
+        {
+            balance.set(tx, balance.get(tx) - 10);
+        }
+    };
+
+    util::transaction first { domain };
+    util::transaction second { domain };
+    withdraw(first, account.price);
+    withdraw(second, account.quantity);
+    ASSERT_TRUE(first.commit());
+    ASSERT_FALSE(second.commit());
+
+    util::read_view view { domain };
+    ASSERT_EQ (-10.0, account.price.get(view));
+    ASSERT_EQ (10, account.quantity.get(view));
+
+    // The read only transaction commits unless its reads were overwritten.
+    util::transaction reader { domain };
+    ASSERT_EQ (10, account.quantity.get(reader));
+    ASSERT_TRUE(reader.commit());
+}
+
+TEST(property_versioned_testing, idle_property_test)
+{
+    // The versions of a property, which is no longer written, are freed by the other commits,
+    // or by collect after the last one.
+    util::version_domain domain;
+    versioning::item idle;
+    versioning::item busy;
+    const auto write = [&](auto& property, int value)
+    {
+        util::transaction tx { domain };
+        property.set(tx, value);
+        ASSERT_TRUE(tx.commit());
+    };
+
+    {
+        util::read_view view { domain };
+        write(idle.quantity, 1);
+        write(idle.quantity, 2);
+        ASSERT_EQ (3u, idle.quantity.version_count());
+    }
+    write(busy.quantity, 1);
+    ASSERT_EQ (1u, idle.quantity.version_count());
+
+    {
+        util::read_view view { domain };
+        write(idle.quantity, 3);
+        ASSERT_EQ (2u, idle.quantity.version_count());
+    }
+    domain.collect();
+    ASSERT_EQ (1u, idle.quantity.version_count());
+
+    // The destroyed property is no longer tracked.
+    {
+        util::read_view view { domain };
+        versioning::item temporary;
+        write(temporary.quantity, 1);
+    }
+    domain.collect();
+}
+
+TEST(property_versioned_testing, slot_overflow_test)
+{
+    // The readers beyond the slots do not wait, and keep their versions alive.
+    util::version_domain domain;
+    versioning::item i;
+    const auto write = [&](double value)
+    {
+        util::transaction tx { domain };
+        i.price.set(tx, value);
+        ASSERT_TRUE(tx.commit());
+    };
+
+    std::vector<std::unique_ptr<util::read_view>> views;
+    for (std::size_t k = 0; k != util::version_domain::slot_count + 2; ++k)
+    {
+        views.push_back(std::make_unique<util::read_view>(domain));
+        write(double(k + 1));
+    }
+    for (std::size_t k = 0; k != views.size(); ++k)
+    {
+        ASSERT_EQ (double(k), i.price.get(*views[k]));
+    }
+
+    views.clear();
+    write(0);
+    ASSERT_EQ (1u, i.price.version_count());
+}
+
+TEST(property_versioned_testing, invariant_test)
+{
+    // The writers move units between two owners, the readers check that the total is constant.
+    util::version_domain domain;
+    versioning::item left;
+    versioning::item right;
+    std::atomic<bool> stop { false };
+    std::atomic<int> inconsistent { 0 };
+
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 3; ++t)
+    {
+        readers.emplace_back([&]
+        {
+            while (!stop.load())
+            {
+                util::read_view view { domain };
+                if (left.quantity.get(view) + right.quantity.get(view) != 20)
+                {
+                    ++inconsistent;
+                }
+            }
+        });
+    }
+
+    std::vector<std::thread> writers;
+    std::atomic<int> committed { 0 };
+    for (int t = 0; t < 2; ++t)
+    {
+        writers.emplace_back([&]
+        {
+            for (int i = 0; i < 2000; ++i)
+            {
+                util::transaction tx { domain };
+                left.quantity.set(tx, left.quantity.get(tx) - 1);
+                right.quantity.set(tx, right.quantity.get(tx) + 1);
+                committed += tx.commit();
+            }
+        });
+    }
+    for (auto& writer : writers)
+    {
+        writer.join();
+    }
+    stop = true;
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+
+    util::read_view view { domain };
+    ASSERT_EQ (0, inconsistent.load());
+    ASSERT_EQ (std::uint64_t(committed.load()), domain.now());
+    ASSERT_EQ (10 - committed.load(), left.quantity.get(view));
+    ASSERT_EQ (10 + committed.load(), right.quantity.get(view));
+}
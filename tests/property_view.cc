@@ -0,0 +1,156 @@
+/**
+ * @file        property_view.cc
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Unit tests of the property views and the reduction kernels.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "property_view.h"
+
+namespace view
+{
+struct particle
+{
+    template <class ... TArgs>
+    using property_t = util::property<particle, TArgs...>;
+
+    property_t<float, util::public_get_set> x;
+    property_t<double, util::public_get> mass;
+    property_t<std::int32_t, util::public_get_set> id;
+    property_t<long long, util::public_get_set> score;
+    property_t<int> secret;
+
+    particle() = default;
+
+    particle(int i)
+        : x { static_cast<float>(i % 7) }
+        , mass { i * 0.5 }
+        , id { (i * 37) % 101 - 50 }
+        , score { i }
+    {
+    }
+};
+
+template <typename TMember>
+constexpr bool is_viewable =
+    std::is_constructible_v<util::property_view<int>, std::vector<particle>&, TMember>;
+
+template <typename T>
+std::vector<T> values(const util::property_view<T>& view)
+{
+    return { view.begin(), view.end() };
+}
+
+/*
+ * Compares the reductions with the standard algorithms, for the strided and the contiguous views.
+ */
+void check_reductions()
+{
+    for (const int size : { 1, 3, 16, 17, 100, 1001 })
+    {
+        std::vector<particle> particles;
+        for (int i = 0; i < size; ++i)
+        {
+            particles.emplace_back(i);
+        }
+
+        const util::property_view xs { particles, &particle::x };
+        const util::property_view masses { particles, &particle::mass };
+        const util::property_view ids { particles, &particle::id };
+        const util::property_view scores { particles, &particle::score };
+
+        const auto x_values = view::values(xs);
+        const auto mass_values = view::values(masses);
+        const auto id_values = view::values(ids);
+        const auto score_values = view::values(scores);
+
+        // The strided views use the scalar loops, the contiguous ones the vector instructions.
+        for (const auto& x : { xs, util::property_view { std::span { x_values } } })
+        {
+            ASSERT_EQ (std::accumulate(x_values.begin(), x_values.end(), 0.0f), util::sum(x));
+            ASSERT_EQ (*std::min_element(x_values.begin(), x_values.end()), util::min(x));
+            ASSERT_EQ (*std::max_element(x_values.begin(), x_values.end()), util::max(x));
+            ASSERT_EQ (std::count(x_values.begin(), x_values.end(), 3.0f), util::count(x, 3.0f));
+        }
+        for (const auto& mass : { masses, util::property_view { std::span { mass_values } } })
+        {
+            ASSERT_DOUBLE_EQ (std::accumulate(mass_values.begin(), mass_values.end(), 0.0),
+                              util::sum(mass));
+            ASSERT_EQ (mass_values.front(), util::min(mass));
+            ASSERT_EQ (mass_values.back(), util::max(mass));
+            ASSERT_EQ (size > 4 ? 1u : 0u, util::count(mass, 2.0));
+        }
+        for (const auto& id : { ids, util::property_view { std::span { id_values } } })
+        {
+            ASSERT_EQ (std::accumulate(id_values.begin(), id_values.end(), 0), util::sum(id));
+            ASSERT_EQ (*std::min_element(id_values.begin(), id_values.end()), util::min(id));
+            ASSERT_EQ (*std::max_element(id_values.begin(), id_values.end()), util::max(id));
+            ASSERT_EQ (std::count(id_values.begin(), id_values.end(), -50),
+                       util::count(id, -50));
+        }
+        ASSERT_EQ (std::accumulate(score_values.begin(), score_values.end(), 0LL),
+                   util::sum(scores));
+        ASSERT_EQ (size - 1, util::max(scores));
+    }
+}
+}
+
+TEST(property_view_testing, view_test)
+{
+    using view::particle;
+    static_assert(std::random_access_iterator<util::property_view<float>::iterator>);
+    ASSERT_TRUE(view::is_viewable<decltype(&particle::id)>);
+    ASSERT_FALSE(view::is_viewable<decltype(&particle::secret)>);
+
+    std::vector<particle> particles;
+    for (int i = 0; i < 10; ++i)
+    {
+        particles.emplace_back(i);
+    }
+    util::property_view ids { particles, &particle::id };
+    static_assert(std::is_same_v<decltype(ids), util::property_view<std::int32_t>>);
+    ASSERT_EQ (10u, ids.size());
+    ASSERT_FALSE(ids.is_contiguous());
+    ASSERT_EQ (static_cast<std::ptrdiff_t>(sizeof(particle)), ids.stride());
+    ASSERT_EQ (-13, ids[1]);
+    particles[1].id = 5;
+    ASSERT_EQ (5, ids[1]);
+    ASSERT_EQ (10, std::distance(ids.begin(), ids.end()));
+    ASSERT_EQ (5, *(ids.begin() + 1));
+
+    std::vector<float> raw { 1.0f, 2.0f, 3.0f };
+    util::property_view contiguous { std::span { raw } };
+    ASSERT_TRUE(contiguous.is_contiguous());
+    ASSERT_EQ (raw, view::values(contiguous));
+
+    const std::vector<particle> empty;
+    util::property_view none { empty, &particle::mass };
+    ASSERT_TRUE(none.empty());
+    ASSERT_FALSE(util::min(none).has_value());
+    ASSERT_EQ (0.0, util::sum(none));
+}
+
+TEST(property_view_testing, reduction_test)
+{
+    // Every instruction set the processor runs gives the results of the scalar loops.
+    using util::impl::simd_level;
+    auto& level = util::impl::active_simd_level();
+    const auto supported = level;
+    for (const auto tested : { simd_level::scalar, simd_level::avx2, simd_level::avx512f })
+    {
+        if (tested <= supported)
+        {
+            level = tested;
+            view::check_reductions();
+        }
+    }
+    level = supported;
+}
@@ -0,0 +1,60 @@
+/**
+ * @file        temporary_file.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       The temporary file of the unit tests, which work with the files.
+ * @date        10/16/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#ifndef PROPERTY_TESTS_TEMPORARY_FILE_H
+#define PROPERTY_TESTS_TEMPORARY_FILE_H
+
+#include <filesystem>
+#include <string>
+
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+namespace testing_support
+{
+/**
+ * The path in the temporary directory, unique for the current test and process. The file is
+ * removed before and after the test.
+ */
+class temporary_file
+{
+public:
+    temporary_file()
+        : m_path { std::filesystem::temp_directory_path() / file_name() }
+    {
+        std::filesystem::remove(m_path);
+    }
+
+    ~temporary_file()
+    {
+        std::filesystem::remove(m_path);
+    }
+
+    temporary_file(const temporary_file&) = delete;
+    temporary_file& operator=(const temporary_file&) = delete;
+
+    const std::filesystem::path& path() const
+    {
+        return m_path;
+    }
+
+private:
+    static std::string file_name()
+    {
+        const auto* test = ::testing::UnitTest::GetInstance()->current_test_info();
+        return std::string { test->test_suite_name() } + "_" + test->name() + "_"
+            + std::to_string(::getpid()) + ".bin";
+    }
+
+private:
+    std::filesystem::path m_path;
+};
+}
+
+#endif // PROPERTY_TESTS_TEMPORARY_FILE_H